@@ -5,7 +5,7 @@
 
 
 // Sets default values
-APS_EnemyBase::APS_EnemyBase()
+APS_EnemyBase::APS_EnemyBase(const FObjectInitializer& objectInitializer) : Super(objectInitializer)
 {
 	// Set this character to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
 	PrimaryActorTick.bCanEverTick = true;
@@ -13,7 +13,7 @@ class PROJECTSLICE_API APS_EnemyBase : public APS_CharacterBase
 
 public:
 	// Sets default values for this character's properties
-	APS_EnemyBase();
+	APS_EnemyBase(const FObjectInitializer& objectInitializer);
 
 protected:
 	// Called when the game starts or when spawned
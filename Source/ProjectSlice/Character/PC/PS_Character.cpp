@@ -17,7 +17,7 @@
 
 DEFINE_LOG_CATEGORY(LogTemplateCharacter);
 
-AProjectSliceCharacter::AProjectSliceCharacter()
+AProjectSliceCharacter::AProjectSliceCharacter(const FObjectInitializer& objectInitializer) : Super(objectInitializer.SetDefaultSubobjectClass<UPS_CharacterMovementComponent>(ACharacter::CharacterMovementComponentName))
 {
 	//If inherited components are invalids
 	if(!IsValid(GetMesh()) || !IsValid(GetCapsuleComponent()) || !IsValid(GetArrowComponent()))
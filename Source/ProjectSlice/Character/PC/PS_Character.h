@@ -10,6 +10,7 @@
 #include "ProjectSlice/Character/PS_CharacterBase.h"
 #include "ProjectSlice/Components/PC/PS_WeaponComponent.h"
 #include "ProjectSlice/Components/Common/PS_ProceduralAnimComponent.h"
+#include "ProjectSlice/Components/PC/PS_CharacterMovementComponent.h"
 #include "ProjectSlice/Components/PC/PS_ParkourComponent.h"
 #include "ProjectSlice/Components/PC/PS_SlowmoComponent.h"
 #include "PS_Character.generated.h"
@@ -75,7 +76,7 @@ class PROJECTSLICE_API AProjectSliceCharacter : public APS_CharacterBase
 
 	
 public:
-	AProjectSliceCharacter();
+	AProjectSliceCharacter(const FObjectInitializer& objectInitializer);
 
 	virtual void TickActor(float DeltaTime, ELevelTick TickType, FActorTickFunction& ThisTickFunction) override;
 
@@ -125,6 +126,10 @@ public:
 	UFUNCTION(BlueprintCallable)
 	UPhysicalAnimationComponent* GetPhysicAnimComponent() const{return PhysicAnimComponent;}
 
+	/** Returns CharacterMovement as project movement component **/
+	UFUNCTION(BlueprintCallable)
+	UPS_CharacterMovementComponent* GetPSCharacterMovement() const{return Cast<UPS_CharacterMovementComponent>(GetCharacterMovement());}
+
 protected:
 	virtual void BeginPlay();
 	
@@ -8,7 +8,7 @@
 
 
 // Sets default values
-APS_CharacterBase::APS_CharacterBase()
+APS_CharacterBase::APS_CharacterBase(const FObjectInitializer& objectInitializer) : Super(objectInitializer)
 {
 	// Set this character to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
 	PrimaryActorTick.bCanEverTick = true;
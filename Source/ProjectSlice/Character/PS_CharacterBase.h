@@ -13,7 +13,7 @@ class PROJECTSLICE_API APS_CharacterBase : public ACharacter
 
 public:
 	// Sets default values for this character's properties
-	APS_CharacterBase();
+	APS_CharacterBase(const FObjectInitializer& objectInitializer);
 
 protected:
 	// Called when the game starts or when spawned
@@ -166,10 +166,10 @@ void UPS_ProceduralAnimComponent::StartWalkingAnimWithDelay(const float delay)
 
 	if (bDebug) UE_LOG(LogTemp, Log, TEXT("%S"),__FUNCTION__);
 	
-	FTimerHandle startWalkingAnimHandler;
+	FPSTimerHandle startWalkingAnimHandler;
 	FTimerDelegate startWalkingAnim_TimerDelegate;
 	startWalkingAnim_TimerDelegate.BindUObject(this, &UPS_ProceduralAnimComponent::StartWalkingAnim);
-	UPSFl::SetDilatedRealTimeTimer(GetWorld(),startWalkingAnimHandler, startWalkingAnim_TimerDelegate, delay, false, GetOwner()->CustomTimeDilation);
+	UPSFl::SetPSTimer(GetWorld(),startWalkingAnimHandler, startWalkingAnim_TimerDelegate, delay, false, EPSTimerClock::ACTOR_TIME, -1.0f, 1.0f, GetOwner());
 }
 
 void UPS_ProceduralAnimComponent::StopWalkingAnim()
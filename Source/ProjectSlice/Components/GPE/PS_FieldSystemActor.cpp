@@ -3,6 +3,10 @@
 
 #include "PS_FieldSystemActor.h"
 
+#include "Components/ShapeComponent.h"
+#include "Field/FieldSystemComponent.h"
+#include "ProjectSlice/System/PS_ImpactFieldPoolSubsystem.h"
+
 
 // Sets default values
 APS_FieldSystemActor::APS_FieldSystemActor()
@@ -24,4 +28,78 @@ void APS_FieldSystemActor::Tick(float DeltaTime)
 	Super::Tick(DeltaTime);
 }
 
+#pragma region Pool
+//------------------
+
+void APS_FieldSystemActor::LifeSpanExpired()
+{
+	if(ReturnToPool()) return;
+
+	Super::LifeSpanExpired();
+}
+
+void APS_FieldSystemActor::K2_DestroyActor()
+{
+	if(ReturnToPool()) return;
+
+	Super::K2_DestroyActor();
+}
+
+bool APS_FieldSystemActor::ReturnToPool()
+{
+	if(!IsValid(GetWorld())) return false;
+
+	UPS_ImpactFieldPoolSubsystem* poolSubsystem = GetWorld()->GetSubsystem<UPS_ImpactFieldPoolSubsystem>();
+	return IsValid(poolSubsystem) && poolSubsystem->ReleaseField(this);
+}
+
+bool APS_FieldSystemActor::ReplaysBeginPlay() const
+{
+	const UClass* fieldClass = GetClass();
+	const bool bActsInBeginPlay = fieldClass->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(APS_FieldSystemActor, ReceiveBeginPlay));
+	const bool bHasPoolEvent = fieldClass->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(APS_FieldSystemActor, ReceiveAcquiredFromPool));
+
+	return bActsInBeginPlay && !bHasPoolEvent;
+}
+
+void APS_FieldSystemActor::OnAcquiredFromPool(const FTransform& transform, UObject* user, const bool bReplayBeginPlay)
+{
+	_PoolUser = user;
+
+	SetActorTransform(transform, false, nullptr, ETeleportType::TeleportPhysics);
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+	SetActorTickEnabled(PrimaryActorTick.bStartWithTickEnabled);
+	if(IsValid(GetFieldSystemComponent())) GetFieldSystemComponent()->Activate(true);
+
+	//Same lifespan as a fresh spawn
+	SetLifeSpan(InitialLifeSpan);
+
+	//Field blueprints activate in BeginPlay, run it again for this use
+	if(bReplayBeginPlay) ReceiveBeginPlay();
+
+	ReceiveAcquiredFromPool();
+}
+
+void APS_FieldSystemActor::OnReleasedToPool()
+{
+	//Next user must not receive the previous user callbacks
+	UShapeComponent* collider = GetCollider();
+	if(IsValid(collider) && _PoolUser.IsValid())
+	{
+		collider->OnComponentBeginOverlap.RemoveAll(_PoolUser.Get());
+		collider->OnComponentEndOverlap.RemoveAll(_PoolUser.Get());
+	}
+	_PoolUser.Reset();
+
+	ReceiveReleasedToPool();
+
+	SetLifeSpan(0.0f);
+	if(IsValid(GetFieldSystemComponent())) GetFieldSystemComponent()->Deactivate();
+	SetActorTickEnabled(false);
+	SetActorEnableCollision(false);
+	SetActorHiddenInGame(true);
+}
 
+//------------------
+#pragma endregion Pool
@@ -28,4 +28,42 @@ public:
 	UShapeComponent* GetCollider();
 	UShapeComponent* GetCollider_Implementation(){return nullptr;};
 
+#pragma region Pool
+	//------------------
+
+public:
+	// Lifespan expiry returns the field to the pool instead of destroying it
+	virtual void LifeSpanExpired() override;
+
+	virtual void K2_DestroyActor() override;
+
+	// Called by UPS_ImpactFieldPoolSubsystem only
+	void OnAcquiredFromPool(const FTransform& transform, UObject* user, const bool bReplayBeginPlay);
+
+	void OnReleasedToPool();
+
+	FORCEINLINE UObject* GetPoolUser() const { return _PoolUser.Get(); }
+
+	// Blueprint acting in BeginPlay without ReceiveAcquiredFromPool, its BeginPlay is replayed on each reuse
+	bool ReplaysBeginPlay() const;
+
+	// Field spawned for its first use, BeginPlay already activated it
+	FORCEINLINE void SetPoolUser(UObject* user) { _PoolUser = user; }
+
+protected:
+	// Pooled field only BeginPlay once, use these for per use logic
+	UFUNCTION(BlueprintImplementableEvent, Category="Pool")
+	void ReceiveAcquiredFromPool();
+
+	UFUNCTION(BlueprintImplementableEvent, Category="Pool")
+	void ReceiveReleasedToPool();
+
+private:
+	bool ReturnToPool();
+
+	UPROPERTY(Transient)
+	TWeakObjectPtr<UObject> _PoolUser;
+
+	//------------------
+#pragma endregion Pool
 };
@@ -14,6 +14,7 @@
 #include "ProjectSlice/Data/PS_Constants.h"
 #include "ProjectSlice/Data/PS_TraceChannels.h"
 #include "ProjectSlice/FunctionLibrary/PSFl.h"
+#include "ProjectSlice/FunctionLibrary/PSFL_GeometryScript.h"
 
 
 // Sets default values for this component's properties
@@ -92,6 +93,9 @@ void UPS_SlicedComponent::InitSliceObject()
 	//Init Physic
 	const bool bIsNotFixed = GetOwner()->ActorHasTag(TAG_UNFIXED);
 	SetSimulatePhysics(bIsNotFixed);
+
+	//Geometry changed
+	MarkGeometryDirty();
 	
 }
 
@@ -108,6 +112,19 @@ void UPS_SlicedComponent::InitComponent()
 	GetBodyInstance()->WakeInstance();
 }
 
+const TArray<FVector>& UPS_SlicedComponent::GetConvexHullPoints()
+{
+	if (_bConvexHullDirty)
+	{
+		UPSFL_GeometryScript::ComputeConvexHullPoints(this, _ConvexHullPoints);
+		_bConvexHullDirty = false;
+		
+		if(bDebug) UE_LOG(LogTemp, Log, TEXT("%S :: %s rebuilt hull with %i points"), __FUNCTION__, *GetName(), _ConvexHullPoints.Num());
+	}
+	
+	return _ConvexHullPoints;
+}
+
 void UPS_SlicedComponent::OnSlicedObjectHitEventReceived(UPrimitiveComponent* HitComponent, AActor* OtherActor,
 	UPrimitiveComponent* OtherComp, FVector NormalImpulse, const FHitResult& Hit)
 {
@@ -59,6 +59,32 @@ private:
 //------------------	
 #pragma endregion General
 
+#pragma region Hull
+	//------------------
+
+public:
+	/** Convex hull vertices in component space, lazily rebuilt after a slice */
+	const TArray<FVector>& GetConvexHullPoints();
+
+	/** Flag the cached geometry data as outdated, call it whenever the mesh geometry changes */
+	FORCEINLINE void MarkGeometryDirty() { _bConvexHullDirty = true; _MeshRevision++; }
+
+	/** Incremented on each geometry change, used to invalidate geometry caches */
+	FORCEINLINE uint32 GetMeshRevision() const { return _MeshRevision; }
+
+private:
+	UPROPERTY(Transient)
+	uint32 _MeshRevision = 0;
+
+	UPROPERTY(Transient)
+	TArray<FVector> _ConvexHullPoints;
+
+	UPROPERTY(Transient)
+	bool _bConvexHullDirty = true;
+
+	//------------------
+#pragma endregion Hull
+
 #pragma region Feedback
 	//------------------
 
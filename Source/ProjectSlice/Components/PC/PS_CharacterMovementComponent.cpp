@@ -0,0 +1,138 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "PS_CharacterMovementComponent.h"
+
+#include "DrawDebugHelpers.h"
+#include "GameFramework/Character.h"
+
+bool UPS_CharacterMovementComponent::IsFalling() const
+{
+	return Super::IsFalling() || IsSwinging();
+}
+
+float UPS_CharacterMovementComponent::GetMaxSpeed() const
+{
+	//Same speed budget as falling
+	if(IsSwinging()) return IsCrouching() ? MaxWalkSpeedCrouched : MaxWalkSpeed;
+
+	return Super::GetMaxSpeed();
+}
+
+void UPS_CharacterMovementComponent::PhysCustom(float deltaTime, int32 Iterations)
+{
+	if(CustomMovementMode == static_cast<uint8>(ECustomMovementMode::CMOVE_SWING))
+	{
+		PhysSwing(deltaTime, Iterations);
+		return;
+	}
+
+	Super::PhysCustom(deltaTime, Iterations);
+}
+
+#pragma region Swing
+//------------------
+
+void UPS_CharacterMovementComponent::StartSwing(const FVector& pivot, const float ropeLength)
+{
+	SetSwingConstraint(pivot, ropeLength);
+	SetMovementMode(MOVE_Custom, static_cast<uint8>(ECustomMovementMode::CMOVE_SWING));
+
+	if(bDebugSwing) UE_LOG(LogTemp, Log, TEXT("%S :: pivot %s, length %f, velocity %f"), __FUNCTION__, *pivot.ToString(), ropeLength, Velocity.Length());
+}
+
+void UPS_CharacterMovementComponent::SetSwingConstraint(const FVector& pivot, const float ropeLength)
+{
+	_SwingPivot = pivot;
+	_SwingRopeLength = FMath::Max(ropeLength, 0.0f);
+}
+
+void UPS_CharacterMovementComponent::StopSwing()
+{
+	if(!IsSwinging()) return;
+
+	SetMovementMode(MOVE_Falling);
+
+	if(bDebugSwing) UE_LOG(LogTemp, Log, TEXT("%S :: velocity %f"), __FUNCTION__, Velocity.Length());
+}
+
+bool UPS_CharacterMovementComponent::IsSwinging() const
+{
+	return MovementMode == MOVE_Custom && CustomMovementMode == static_cast<uint8>(ECustomMovementMode::CMOVE_SWING);
+}
+
+FVector UPS_CharacterMovementComponent::SolveSwingConstraint(const FVector& targetLoc) const
+{
+	//Rope only pull, slack rope let player fall freely
+	const FVector pivotToTarget = targetLoc - _SwingPivot;
+	if(pivotToTarget.SizeSquared() <= FMath::Square(_SwingRopeLength)) return targetLoc;
+
+	return _SwingPivot + pivotToTarget.GetSafeNormal() * _SwingRopeLength;
+}
+
+void UPS_CharacterMovementComponent::PhysSwing(float deltaTime, int32 Iterations)
+{
+	if(deltaTime < MIN_TICK_TIME) return;
+
+	float remainingTime = deltaTime;
+	while(remainingTime >= MIN_TICK_TIME && Iterations < MaxSimulationIterations && IsSwinging() && HasValidData())
+	{
+		Iterations++;
+		const float timeTick = GetSimulationTimeStep(remainingTime, Iterations);
+		remainingTime -= timeTick;
+
+		const FVector oldLoc = UpdatedComponent->GetComponentLocation();
+		const FQuat oldRot = UpdatedComponent->GetComponentQuat();
+
+		//Predict: gravity + air control, semi implicit euler
+		const FVector gravity = -GetGravityDirection() * GetGravityZ() * SwingGravityScale;
+		const FVector airControlAccel = GetFallingLateralAcceleration(timeTick);
+		Velocity += (gravity + airControlAccel) * timeTick;
+		Velocity *= FMath::Max(1.0f - SwingDamping * timeTick, 0.0f);
+
+		//Constraint: project on rope sphere
+		const FVector targetLoc = SolveSwingConstraint(oldLoc + Velocity * timeTick);
+		const FVector delta = targetLoc - oldLoc;
+
+		FHitResult hit(1.0f);
+		SafeMoveUpdatedComponent(delta, oldRot, true, hit);
+
+		if(hit.IsValidBlockingHit())
+		{
+			//Landed during swing
+			if(IsValidLandingSpot(UpdatedComponent->GetComponentLocation(), hit))
+			{
+				remainingTime += timeTick * (1.0f - hit.Time);
+				ProcessLanded(hit, remainingTime, Iterations);
+				return;
+			}
+
+			//Slide along wall, then keep rope taut
+			HandleImpact(hit, timeTick, delta);
+			SlideAlongSurface(delta, 1.0f - hit.Time, hit.Normal, hit, true);
+
+			const FVector slidLoc = UpdatedComponent->GetComponentLocation();
+			const FVector constrainedLoc = SolveSwingConstraint(slidLoc);
+			if(!constrainedLoc.Equals(slidLoc))
+			{
+				FHitResult constraintHit;
+				SafeMoveUpdatedComponent(constrainedLoc - slidLoc, oldRot, true, constraintHit);
+			}
+		}
+
+		//Velocity from real displacement, radial velocity removed by the projection
+		if(!HasAnimRootMotion() && !CurrentRootMotion.HasOverrideVelocity() && timeTick > UE_SMALL_NUMBER)
+		{
+			Velocity = (UpdatedComponent->GetComponentLocation() - oldLoc) / timeTick;
+		}
+
+		if(bDebugSwing)
+		{
+			DrawDebugLine(GetWorld(), _SwingPivot, UpdatedComponent->GetComponentLocation(), FColor::Cyan, false, -1.0f, 0, 1.0f);
+			DrawDebugPoint(GetWorld(), _SwingPivot, 20.0f, FColor::Red, false, -1.0f);
+		}
+	}
+}
+
+//------------------
+#pragma endregion Swing
@@ -0,0 +1,85 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "PS_CharacterMovementComponent.generated.h"
+
+UENUM(BlueprintType)
+enum class ECustomMovementMode : uint8
+{
+	CMOVE_NONE = 0 UMETA(DisplayName = "None"),
+	CMOVE_SWING = 1 UMETA(DisplayName = "Swing"),
+};
+
+/**
+ * Player movement, adds a swing custom mode: pendulum around a pivot integrated in the movement step,
+ * rope kept as a position based distance constraint (no physic constraint, no allocation).
+ */
+UCLASS(Blueprintable, ClassGroup=(Component), meta=(BlueprintSpawnableComponent))
+class PROJECTSLICE_API UPS_CharacterMovementComponent : public UCharacterMovementComponent
+{
+	GENERATED_BODY()
+
+public:
+	// Swing is still an air movement for jump, parkour and animation
+	virtual bool IsFalling() const override;
+
+	virtual float GetMaxSpeed() const override;
+
+protected:
+	virtual void PhysCustom(float deltaTime, int32 Iterations) override;
+
+#pragma region Swing
+	//------------------
+
+public:
+	/*
+	 * @brief Enter swing custom mode, current velocity is kept
+	 * @param pivot: rope point the player swing around
+	 * @param ropeLength: max distance to pivot
+	 */
+	UFUNCTION(BlueprintCallable)
+	void StartSwing(const FVector& pivot, const float ropeLength);
+
+	// Pivot && length can move every frame (wrap, winde)
+	UFUNCTION(BlueprintCallable)
+	void SetSwingConstraint(const FVector& pivot, const float ropeLength);
+
+	// Back to falling with swing velocity
+	UFUNCTION(BlueprintCallable)
+	void StopSwing();
+
+	UFUNCTION(BlueprintCallable)
+	bool IsSwinging() const;
+
+	FORCEINLINE FVector GetSwingPivot() const { return _SwingPivot; }
+
+	FORCEINLINE float GetSwingRopeLength() const { return _SwingRopeLength; }
+
+protected:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Parameters|Swing", meta=(UIMin="0", ClampMin="0"))
+	float SwingGravityScale = 1.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Parameters|Swing", meta=(UIMin="0", ClampMin="0", UIMax="1", ClampMax="1", ToolTip="Velocity lost per second along the swing"))
+	float SwingDamping = 0.02f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Debug")
+	bool bDebugSwing = false;
+
+private:
+	void PhysSwing(float deltaTime, int32 Iterations);
+
+	// Project target on the rope sphere if rope is taut
+	FVector SolveSwingConstraint(const FVector& targetLoc) const;
+
+	UPROPERTY(Transient)
+	FVector _SwingPivot = FVector::ZeroVector;
+
+	UPROPERTY(Transient)
+	float _SwingRopeLength = 0.0f;
+
+	//------------------
+#pragma endregion Swing
+};
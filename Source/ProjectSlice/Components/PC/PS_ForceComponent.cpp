@@ -12,6 +12,7 @@
 #include "ProjectSlice/Data/PS_GlobalType.h"
 #include "ProjectSlice/Data/PS_TraceChannels.h"
 #include "ProjectSlice/FunctionLibrary/PSFl.h"
+#include "ProjectSlice/System/PS_DelayedImpulseSubsystem.h"
 
 
 class UPS_SlicedComponent;
@@ -43,6 +44,14 @@ void UPS_ForceComponent::BeginPlay()
 	//Screw Attach 
 	AttachScrew();
 
+	PrewarmImpactFields();
+
+	_DelayedImpulseSubsystem = GetWorld()->GetSubsystem<UPS_DelayedImpulseSubsystem>();
+	if(IsValid(_DelayedImpulseSubsystem))
+	{
+		_DelayedImpulseSubsystem->OnImpulseApplied.AddUObject(this, &UPS_ForceComponent::OnDelayedImpulseApplied);
+	}
+
 	//Callback
 	OnPushReleaseNotifyEvent.AddUniqueDynamic(this, &UPS_ForceComponent::OnPushReleasedEventReceived);
 	if(IsValid(_PlayerCharacter->GetProceduralAnimComponent()))
@@ -65,6 +74,12 @@ void UPS_ForceComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	Super::EndPlay(EndPlayReason);
 
 	//Unbind Callback
+	if(IsValid(_DelayedImpulseSubsystem))
+	{
+		_DelayedImpulseSubsystem->CancelImpulses(this);
+		_DelayedImpulseSubsystem->OnImpulseApplied.RemoveAll(this);
+	}
+	
 	OnPushReleaseNotifyEvent.RemoveDynamic(this, &UPS_ForceComponent::OnPushReleasedEventReceived);
 	if(IsValid(_PlayerCharacter->GetProceduralAnimComponent()))
 	{
@@ -204,31 +219,40 @@ void UPS_ForceComponent::ReleasePush()
 	TArray<AActor*> actorsToIgnore;
 	actorsToIgnore.AddUnique(_PlayerCharacter);
 
-	UPSFl::SweepConeMultiByChannel(GetWorld(),_StartForcePushLoc, _DirForcePush,ConeAngleDegrees, ConeLength, StepInterval,outHits, ECC_GPE, actorsToIgnore, bDebugPush);
+	//One hit per component, sorted by distance
+	UPSFl::OverlapConeMultiByChannel(GetWorld(),_StartForcePushLoc, _DirForcePush,ConeAngleDegrees, ConeLength, outHits, ECC_GPE, actorsToIgnore, bDebugPush);
+	
+	//Keep pushable targets
+	TArray<FHitResult> targetHits;
+	TArray<FVector> viewStarts;
+	TArray<FVector> viewEnds;
+	targetHits.Reserve(outHits.Num());
+	viewStarts.Reserve(outHits.Num());
+	viewEnds.Reserve(outHits.Num());
+	for (const FHitResult& outHitResult : outHits)
+	{
+		//Check comp type
+		const UMeshComponent* outMeshComp = Cast<UMeshComponent>(outHitResult.GetComponent());
+		if(!IsValid(outMeshComp) || outMeshComp->Mobility != EComponentMobility::Movable) continue;
+
+		targetHits.Add(outHitResult);
+		viewStarts.Add(_StartForcePushLoc);
+		viewEnds.Add(outHitResult.ImpactPoint);
+	}
 
-	//Sort Hits result
-	TArray<FHitResult> filteredHitResult;
-	SortPushTargets(outHits, filteredHitResult);
+	//Testing if objects are blocking view line, all targets in one batch
+	TArray<FHitResult> lineViewHits;
+	UPSFl::LineTraceSingleBatchByChannel(GetWorld(), viewStarts, viewEnds, lineViewHits, ECC_Visibility, actorsToIgnore, bDebugPush);
 	
 	//Impulse
 	int32 iteration = 0;
-	for (FHitResult outHitResult : filteredHitResult)
+	for (int32 targetIndex = 0; targetIndex < targetHits.Num(); ++targetIndex)
 	{
-		//Check comp type
+		const FHitResult& outHitResult = targetHits[targetIndex];
+		const FHitResult& lineViewHit = lineViewHits[targetIndex];
 		UMeshComponent* outMeshComp = Cast<UMeshComponent>(outHitResult.GetComponent());
 		UGeometryCollectionComponent* outGeometryComp = Cast<UGeometryCollectionComponent>(outHitResult.GetComponent());
 
-		if((!IsValid(outMeshComp) && !IsValid(outGeometryComp)) || outMeshComp->Mobility != EComponentMobility::Movable )
-		{
-			iteration++;
-			continue;
-		}
-		
-		//Testing id object is blocking view line
-		FHitResult lineViewHit;
-		UKismetSystemLibrary::LineTraceSingle(GetWorld(), _StartForcePushLoc, outHitResult.ImpactPoint, UEngineTypes::ConvertToTraceType(ECC_Visibility),
-			false, actorsToIgnore, bDebugPush ? EDrawDebugTrace::ForDuration : EDrawDebugTrace::None, lineViewHit, true);
-
 		if (lineViewHit.bBlockingHit && lineViewHit.GetActor() != outHitResult.GetActor())
 		{
 			UE_LOG(LogTemp, Warning, TEXT("%S :: %s is not in Push line view "),__FUNCTION__, *outHitResult.GetActor()->GetActorNameOrLabel());
@@ -248,7 +272,7 @@ void UPS_ForceComponent::ReleasePush()
 		
 		//Chaos
 		//Field is moving so we don't need to create multiple of them
-		if(IsValid(outGeometryComp) && !IsValid(_ImpactField) && !_bCanMoveField)
+		if(IsValid(outGeometryComp) && !IsImpactFieldActive() && !_bCanMoveField)
 		{
 			const float radius = FMath::Sqrt(currentDistSquared) * FMath::DegreesToRadians(ConeAngleDegrees);
 
@@ -279,29 +303,21 @@ void UPS_ForceComponent::ReleasePush()
 			//Calculate mass for weight force 
 			mass = UPSFl::GetObjectUnifiedMass(outMeshComp);
 
-			//Impulse with delay for match with VFX
-			if (IsValid(_SlowmoComp))
+			//If currently in slowmo change custom dilation
+			if (IsValid(_SlowmoComp) && IsValid(outHitResult.GetActor()))
 			{
-				//If currently in slowmo change custom dilation
-				if (IsValid(outHitResult.GetActor()))
-				{
-					_SlowmoComp->UpdateObjectDilation(outHitResult.GetActor(), outMeshComp);
-				}
-
-				//Set delayed by distance Impusle callbac
-				const FVector impulseVel = _DirForcePush * (force * mass);
-				UPSFl::SetDilatedRealTimeTimerWithCallback(GetWorld(), [this, outMeshComp, impulseVel, lineViewHit]()
-				{
-					Impulse(outMeshComp, impulseVel, lineViewHit);
-				}, duration, _SlowmoComp->GetPlayerTimeDilationTarget());
+				_SlowmoComp->UpdateObjectDilation(outHitResult.GetActor(), outMeshComp);
 			}
-			else
+
+			//Impulse with delay by distance for match with VFX
+			if (IsValid(_DelayedImpulseSubsystem))
 			{
-				FTimerHandle timerImpulseHandle;
-				FTimerDelegate timerImpulseDelegate;
-					
-				timerImpulseDelegate.BindUObject(this, &UPS_ForceComponent::Impulse,outMeshComp, _StartForcePushLoc + _DirForcePush * (force * mass), lineViewHit); 
-				GetWorld()->GetTimerManager().SetTimer(timerImpulseHandle, timerImpulseDelegate, duration, false);
+				const bool bIsSlowmo = IsValid(_SlowmoComp) && _SlowmoComp->IsSlowmoActive();
+				const FVector impulseVel = _DirForcePush * (force * mass) * (bIsSlowmo ? GetWorld()->DeltaTimeSeconds : 1.0f);
+				const float dilation = IsValid(_SlowmoComp) ? _SlowmoComp->GetPlayerTimeDilationTarget() : 1.0f;
+				//Clear view line has no impact, target hit point is its end
+				const FVector impulseLoc = lineViewHit.bBlockingHit ? lineViewHit.ImpactPoint : viewEnds[targetIndex];
+				_DelayedImpulseSubsystem->ScheduleImpulse(outMeshComp, impulseVel, duration, dilation, this, impulseLoc);
 			}
 		
 			if(bDebugPush) UE_LOG(LogTemp, Log, TEXT("%S :: Impulse actor %s, compHit %s,  force %f, mass %f, pushForce %f, alphainput %f, duration %f"),__FUNCTION__,*outMeshComp->GetOwner()->GetActorNameOrLabel(), *outMeshComp->GetName(), force, mass, PushForce, _AlphaInput, duration);
@@ -349,41 +365,14 @@ void UPS_ForceComponent::DeterminePushType()
 	}
 }
 
-void UPS_ForceComponent::SortPushTargets(const TArray<FHitResult>& hitsToSort, UPARAM(Ref) TArray<FHitResult>& outFilteredHitResult)
-{
-	// Remove duplicate components
-	TSet<UPrimitiveComponent*> uniqueComp;
-	for (FHitResult outHit : hitsToSort)
-	{
-		if(!IsValid(outHit.GetComponent())) continue;
-		
-		if (outHit.GetComponent() && !uniqueComp.Contains(outHit.GetComponent()))
-		{
-			uniqueComp.Add(outHit.GetComponent());
-			outFilteredHitResult.Add(outHit);
-		}
-	}
-
-	// Sort by distance (nearest to farthest)
-	Algo::Sort(outFilteredHitResult, [](const FHitResult& A, const FHitResult& B)
-	{
-		return A.Distance < B.Distance;
-	});
-
-}
-
-void UPS_ForceComponent::Impulse(UMeshComponent* inComp, const FVector impulse, const FHitResult impactPoint)
+void UPS_ForceComponent::OnDelayedImpulseApplied(UObject* instigator, UMeshComponent* inComp, const FVector& impactPoint)
 {
-	if (!IsValid(inComp) || !IsValid(_SlowmoComp) || !IsValid(GetWorld())) return;
+	if (instigator != this || !IsValid(inComp)) return;
 	
 	if (bDebugPush) UE_LOG(LogTemp, Log, TEXT("%S :: %s"), __FUNCTION__, *inComp->GetReadableName());
-	
-	//Impulse
-	const FVector impulseTimedVel = impulse * (_SlowmoComp->IsSlowmoActive() ? GetWorld()->DeltaTimeSeconds : 1.0f);
-	UPSFl::AddImpulseDilated(this, inComp, impulseTimedVel);
 
 	//Play Impact sound
-	_ImpactForcePushLoc = impactPoint.ImpactPoint;
+	_ImpactForcePushLoc = impactPoint;
 	PlaySound(EPushSFXType::IMPACT);
 }
 
@@ -391,7 +380,7 @@ void UPS_ForceComponent::SetupPush()
 {
 	if(!IsValid(GetWorld())) return;
 
-	if(_bIsPushLoading || GetWorld()->GetTimerManager().IsTimerActive(_CoolDownTimerHandle)) return;
+	if(_bIsPushLoading || UPSFl::IsDilatedRealTimeTimerActive(_CoolDownTimerHandle)) return;
 
 	if(bDebugPush) UE_LOG(LogTemp, Log, TEXT("%S"),__FUNCTION__);
 	
@@ -412,7 +401,7 @@ void UPS_ForceComponent::StopPush()
 	_bIsPushReleased = true;
 	
 	const float duration = _AlphaInput < CoolDownDuration ? CoolDownDuration : _AlphaInput;
-	UPSFl::StartCooldown(GetWorld(),duration,_CoolDownTimerHandle, GetOwner()->CustomTimeDilation);
+	UPSFl::StartCooldown(GetWorld(),duration,_CoolDownTimerHandle, 1.0f, GetOwner());
 
 	OnPushEvent.Broadcast(false);
 }
@@ -538,12 +527,6 @@ void UPS_ForceComponent::GenerateImpactField(const FHitResult& targetHit, const
 		return;
 	}
 	
-	//Spawn param
-	FActorSpawnParameters SpawnInfo;
-	SpawnInfo.Owner = _PlayerCharacter;
-	SpawnInfo.Instigator = _PlayerCharacter;
-	SpawnInfo.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-
 	//Spawn Location
 	FVector loc = targetHit.Location;
 		
@@ -554,9 +537,7 @@ void UPS_ForceComponent::GenerateImpactField(const FHitResult& targetHit, const
 	//Spawn scale
 	FVector scale = (extent * 2) / 100;
 		
-	_ImpactField = GetWorld()->SpawnActor<APS_FieldSystemActor>(FieldSystemActor.Get(), loc, rot, SpawnInfo);
-	_ImpactField->SetActorScale3D(scale);
-
+	_ImpactField = AcquireImpactField(FTransform(rot, loc, scale), _PlayerCharacter);
 	if(!IsValid(_ImpactField)) return;
 	
 	//Stock move field var
@@ -573,7 +554,7 @@ void UPS_ForceComponent::GenerateImpactField(const FHitResult& targetHit, const
 
 void UPS_ForceComponent::UpdateImpactField()
 {
-	if(!IsValid(_ImpactField) || !IsValid(GetWorld())) return;
+	if(!IsImpactFieldActive() || !IsValid(GetWorld())) return;
 
 	if(!_bCanMoveField) return;
 
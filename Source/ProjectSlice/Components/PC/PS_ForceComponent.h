@@ -7,10 +7,12 @@
 #include "Kismet/KismetMathLibrary.h"
 #include "ProjectSlice/Data/PS_Delegates.h"
 #include "ProjectSlice/Interface/PS_CanGenerateImpactField.h"
+#include "ProjectSlice/System/PS_TimerSubsystem.h"
 #include "PS_ForceComponent.generated.h"
 
 
 class UPS_SlowmoComponent;
+class UPS_DelayedImpulseSubsystem;
 class AProjectSlicePlayerController;
 class APS_FieldSystemActor;
 class AProjectSliceCharacter;
@@ -62,6 +64,9 @@ private:
 	UPROPERTY(Transient)
     UPS_SlowmoComponent* _SlowmoComp;
 
+	UPROPERTY(Transient)
+	UPS_DelayedImpulseSubsystem* _DelayedImpulseSubsystem;
+
 #pragma region General
 	//------------------
 
@@ -100,9 +105,6 @@ public:
 	UFUNCTION()
 	void DeterminePushType();
 		
-	UFUNCTION()
-	static void SortPushTargets(const TArray<FHitResult>& hitsToSort, TArray<FHitResult>& outFilteredHitResult);
-	
 	UFUNCTION()
 	void SetupPush();
 
@@ -182,15 +184,13 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category ="Parameters|Push|Sweep", meta=(UIMin="0", ClampMin="0", ForceUnits="cm"))
 	float ConeLength = 500.0f ;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category ="Parameters|Push|Sweep", meta=(UIMin="0", ClampMin="0", ForceUnits="sec"))
-	float StepInterval = 20.0f; 
 			
 	/** Sound to play each time we fire */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Parameters|Push|Feedback")
 	TMap<EPushSFXType,USoundBase*> PushSounds;
 
-	UFUNCTION()
-	void Impulse(UMeshComponent* inComp, FVector impulse, const FHitResult impactPoint);
+	// Delayed push impulse applied by the delayed impulse subsystem
+	void OnDelayedImpulseApplied(UObject* instigator, UMeshComponent* inComp, const FVector& impactPoint);
 
 private:
 	UPROPERTY(Transient)
@@ -263,7 +263,7 @@ protected:
 
 private:
 	UPROPERTY(Transient)
-	FTimerHandle _CoolDownTimerHandle;
+	FPSTimerHandle _CoolDownTimerHandle;
 	
 	//------------------
 #pragma endregion Cooldown
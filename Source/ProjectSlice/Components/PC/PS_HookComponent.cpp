@@ -17,9 +17,49 @@
 #include "ProjectSlice/Data/PS_Constants.h"
 #include "ProjectSlice/FunctionLibrary/PSFl.h"
 #include "ProjectSlice/FunctionLibrary/PSFL_GeometryScript.h"
+#include "Misc/ScopeExit.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "PhysicsProxy/SingleParticlePhysicsProxy.h"
 
 class UCableComponent;
 
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Cable Pool Hits"), STAT_HookCablePoolHits, STATGROUP_Hook);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Cable Pool Misses"), STAT_HookCablePoolMisses, STATGROUP_Hook);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Cable Pool Free"), STAT_HookCablePoolFree, STATGROUP_Hook);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Cable Pool Hit Rate %"), STAT_HookCablePoolHitRate, STATGROUP_Hook);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Cap Pool Hits"), STAT_HookCapPoolHits, STATGROUP_Hook);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Cap Pool Misses"), STAT_HookCapPoolMisses, STATGROUP_Hook);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Cap Pool Free"), STAT_HookCapPoolFree, STATGROUP_Hook);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Cap Pool Hit Rate %"), STAT_HookCapPoolHitRate, STATGROUP_Hook);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Cable Traces"), STAT_HookCableTraces, STATGROUP_Hook);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Geodesic Queries"), STAT_HookGeodesicQueries, STATGROUP_Hook);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Physics Substeps"), STAT_HookPhysicsSubsteps, STATGROUP_Hook);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Live Cables"), STAT_HookLiveCables, STATGROUP_Hook);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Live Cable Segments"), STAT_HookLiveCableSegments, STATGROUP_Hook);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Live Caps"), STAT_HookLiveCaps, STATGROUP_Hook);
+DECLARE_CYCLE_STAT(TEXT("Cable Wraping"), STAT_HookCableWraping, STATGROUP_Hook);
+DECLARE_CYCLE_STAT(TEXT("Wrap By First"), STAT_HookWrapByFirst, STATGROUP_Hook);
+DECLARE_CYCLE_STAT(TEXT("Wrap By Last"), STAT_HookWrapByLast, STATGROUP_Hook);
+DECLARE_CYCLE_STAT(TEXT("Unwrap By First"), STAT_HookUnwrapByFirst, STATGROUP_Hook);
+DECLARE_CYCLE_STAT(TEXT("Unwrap By Last"), STAT_HookUnwrapByLast, STATGROUP_Hook);
+DECLARE_CYCLE_STAT(TEXT("Generate Intermediate Point"), STAT_HookGenerateIntermediatePoint, STATGROUP_Hook);
+DECLARE_CYCLE_STAT(TEXT("Power Cable Pull"), STAT_HookPowerCablePull, STATGROUP_Hook);
+DECLARE_CYCLE_STAT(TEXT("Swing Physic"), STAT_HookSwingPhysic, STATGROUP_Hook);
+
+CSV_DEFINE_CATEGORY(Hook, true);
+
+// Cycle stat for stat Hook, named event for Insights, timing for the CSV profiler
+#define HOOK_SCOPE(Name) \
+	SCOPE_CYCLE_COUNTER(STAT_Hook##Name); \
+	TRACE_CPUPROFILER_EVENT_SCOPE(Hook_##Name); \
+	CSV_SCOPED_TIMING_STAT(Hook, Name)
+
+// Per frame counter in both stat Hook and CSV
+#define HOOK_COUNT(Name, Value) \
+	INC_DWORD_STAT_BY(STAT_Hook##Name, Value); \
+	CSV_CUSTOM_STAT(Hook, Name, static_cast<int32>(Value), ECsvCustomStatOp::Accumulate)
+
 // Sets default values for this component's properties
 UPS_HookComponent::UPS_HookComponent()
 {
@@ -33,6 +73,8 @@ UPS_HookComponent::UPS_HookComponent()
 	FirstCable = CreateDefaultSubobject<UCableComponent>(TEXT("FirstCable"));
 	FirstCable->SetCollisionProfileName(Profile_NoCollision, true);
 
+	Rope = CreateDefaultSubobject<UPS_RopeComponent>(TEXT("Rope"));
+
 	HookPhysicConstraint = CreateDefaultSubobject<UPhysicsConstraintComponent>(TEXT("HookConstraint"));
 	HookPhysicConstraint->SetDisableCollision(true);
 
@@ -78,19 +120,31 @@ void UPS_HookComponent::BeginPlay()
 		HookCollider->OnComponentEndOverlap.AddUniqueDynamic(this,  &UPS_HookComponent::OnHookBoxEndOverlapEvent);
 	}
 	
-	//Custom tick - substep to tick at 120 fps (more stable but cable can flicker on unwrap)
-	if(bCanUseSubstepTick)
+	//Physics step tick - pull follows the simulation rate instead of wall clock timers
+	SetAsyncPhysicsTickEnabled(bCanUseSubstepTick);
+
+	//Single rope use first cable look, simulated after the wrap logic
+	if(IsValid(Rope))
 	{
-		FTimerDelegate LowTimerDelegate;
-        LowTimerDelegate.BindUObject(this, &UPS_HookComponent::SubstepTickLowLatency);
-		// 1/90 for extra low latency 
-		GetWorld()->GetTimerManager().SetTimer(_LowSubstepTickHandler, LowTimerDelegate, 1/90.0f, true);
+		Rope->SetVisibility(false);
+		Rope->AddTickPrerequisiteComponent(this);
+		
+		if(bUseSingleRope && IsValid(FirstCable))
+		{
+			Rope->RopeWidth = FirstCable->CableWidth;
+			Rope->NumSides = FirstCable->NumSides;
+			Rope->TileMaterial = FirstCable->TileMaterial;
+			Rope->SetMaterial(0, FirstCable->GetMaterial(0));
 
-		// 1/360 for 120 FPS 
-		FTimerDelegate HighTimerDelegate;
-		HighTimerDelegate.BindUObject(this, &UPS_HookComponent::SubstepTickHighLatency);
-		GetWorld()->GetTimerManager().SetTimer(_HighSubstepTickHandler, HighTimerDelegate, 1/540.0f, true);
+			//Rope simulates the first span too
+			ConfigCableAsRopeView(FirstCable);
+		}
 	}
+
+	//Wrap cables and caps are reused, not created on wrap
+	PrewarmCablePool();
+	PrewarmImpactFields();
+	InitCableTraceParams();
 	
 	//Constraint display
 	GetConstraintAttachMaster()->SetVisibility(bDebugSwing);
@@ -101,6 +155,11 @@ void UPS_HookComponent::BeginPlay()
 void UPS_HookComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
 	Super::EndPlay(EndPlayReason);
+
+	//Stop physics step pull
+	SetAsyncPhysicsTickEnabled(false);
+	PublishPullCommand(FPSHookPullCommand());
+	if(IsValid(_AttachedMesh)) _AttachedMesh->OnComponentPhysicsStateChanged.RemoveDynamic(this, &UPS_HookComponent::OnAttachedMeshPhysicsStateChanged);
 	
 	//Callback
 	if(IsValid(_PlayerCharacter) && IsValid(_PlayerCharacter->GetSlowmoComponent()))
@@ -125,16 +184,47 @@ void UPS_HookComponent::TickComponent(float DeltaTime, ELevelTick TickType,
 	ArmTick();
 	
 	//Cable
-	if(!bCanUseSubstepTick)
+	if(bCanUseSubstepTick)
+	{
+		//Wrap traces only see a new physics state once steps have been simulated
+		if(_PendingPhysicsSteps.exchange(0) > 0) CableWraping();
+	}
+	else
 	{
 		CableWraping();
-
-		PowerCablePull();
 	}
+	
+	PowerCablePull();
+
+	UpdateRope();
 
 	//Swing
 	SwingTick(DeltaTime);
 
+	UpdateHookStats();
+}
+
+void UPS_HookComponent::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
+{
+	UPS_HookComponent* hookComponent = CastChecked<UPS_HookComponent>(InThis);
+	for (FPSCableWrapPoint& wrapPoint : hookComponent->_WrapChain)
+	{
+		Collector.AddReferencedObject(wrapPoint.Component, hookComponent);
+		Collector.AddReferencedObject(wrapPoint.Cap, hookComponent);
+		Collector.AddReferencedObject(wrapPoint.Cable, hookComponent);
+	}
+	
+	Super::AddReferencedObjects(InThis, Collector);
+}
+
+void UPS_HookComponent::AsyncPhysicsTickComponent(float DeltaTime, float SimTime)
+{
+	Super::AsyncPhysicsTickComponent(DeltaTime, SimTime);
+
+	++_PendingPhysicsSteps;
+	HOOK_COUNT(PhysicsSubsteps, 1);
+
+	ApplyPullCommand(DeltaTime);
 }
 
 
@@ -171,8 +261,13 @@ void UPS_HookComponent::InitHookComponent()
 	FirstCable->SetRenderCustomDepth(true);
 	FirstCable->SetCustomDepthStencilValue(200);
 	FirstCable->SetCustomDepthStencilWriteMask(ERendererStencilMask::ERSM_Default);
-	
-	CableListArray.AddUnique(FirstCable);
+
+
+	//Setup Rope
+	Rope->SetupAttachment(this);
+	Rope->SetRenderCustomDepth(true);
+	Rope->SetCustomDepthStencilValue(200);
+	Rope->SetCustomDepthStencilWriteMask(ERendererStencilMask::ERSM_Default);
 
 	//Setup Physic contraint
 	HookPhysicConstraint->SetupAttachment(this);
@@ -276,37 +371,37 @@ void UPS_HookComponent::ArmTick()
 #pragma region Cable
 //------------------
 
-void UPS_HookComponent::SubstepTickLowLatency()
-{
-	if(!bCanUseSubstepTick) return;
-
-	PowerCablePull();
-}
-
-void UPS_HookComponent::SubstepTickHighLatency()
-{
-	if(!bCanUseSubstepTick) return;
-	
-	CableWraping();
-}
-
 void UPS_HookComponent::CableWraping()
 {
+	HOOK_SCOPE(CableWraping);
+
 	//Try Wrap only if attached
 	if(!IsValid(_AttachedMesh) || !IsValid(GetOwner()) || !IsValid(HookThrower)) return;
 
 	if(bDisableCableCodeLogic) return;
 
+	//Last frame batch results
+	if(bAsyncCableTraces) ConsumeCableTraces();
+
 	//Wrap Logics
 	WrapCableAddByLast();
 	WrapCableAddByFirst();
 	
 	UnwrapCableByLast();
 	UnwrapCableByFirst();
-	
+
+	//Batch for the chain as it ends this frame, unread results are outdated
+	if(bAsyncCableTraces)
+	{
+		for (FPSCableTrace& cableTrace : _CableTraces)
+		{
+			cableTrace.bHasResult = false;
+		}
+		RequestCableTraces();
+	}
 }
 
-void UPS_HookComponent::ConfigLastAndSetupNewCable(UCableComponent* lastCable,const FSCableWrapParams& currentTraceCableWrap, UCableComponent*& newCable, const bool bReverseLoc) const
+void UPS_HookComponent::ConfigLastAndSetupNewCable(UCableComponent* lastCable,const FSCableWrapParams& currentTraceCableWrap, UCableComponent*& newCable, const bool bReverseLoc)
 {
 	//Init works Variables
 	const FAttachmentTransformRules AttachmentRule = FAttachmentTransformRules(EAttachmentRule::KeepWorld, EAttachmentRule::KeepWorld, EAttachmentRule::KeepWorld, false);
@@ -315,38 +410,15 @@ void UPS_HookComponent::ConfigLastAndSetupNewCable(UCableComponent* lastCable,co
 	lastCable->AttachToComponent(currentTraceCableWrap.OutHit.GetComponent(), AttachmentRule);
 	lastCable->SetWorldLocation(currentTraceCableWrap.OutHit.Location, false, nullptr,ETeleportType::TeleportPhysics);
 	
-	newCable = Cast<UCableComponent>(GetOwner()->AddComponentByClass(UCableComponent::StaticClass(), false, FTransform(), false));
+	//Reuse a pooled cable, static settings are already set on creation
+	newCable = AcquireCable();
 	if(!IsValid(newCable)) return;
-	//Necessary for appear in BP
-	//GetOwner()->AddInstanceComponent(newCable);
-
-	//Config newCable
-	//-Material
-	//Debug Cable Color OR use FirstCable material
-	SetupCableMaterial(newCable);
-	
-	//Rendering
-	newCable->SetRenderCustomDepth(true);
-	newCable->SetCustomDepthStencilValue(200.0f);
-	newCable->SetCustomDepthStencilWriteMask(ERendererStencilMask::ERSM_Default);
-	newCable->SetReceivesDecals(false);
 
 	//Tense
 	newCable->CableLength = _FirstCableDefaultLenght;
 	newCable->SolverIterations = 1;
-	//newCable->SolverIterations = 8;
-	newCable->bEnableStiffness = FirstCable->bEnableStiffness;
-	
-	newCable->NumSegments = 10; // BE CAREFULL: num segment is involved in CableSocketEnd loc calculation need to stay superior of 1;
-	//newCable->MarkRenderStateDirty(); // Necessary for Update cable, otherwise can cause crash
-	
-	//Opti
-	newCable->bUseSubstepping = true;
-	newCable->bSkipCableUpdateWhenNotVisible = true;
-
-	//Collision
-	newCable->bEnableCollision = false;
-	newCable->SetCollisionProfileName(Profile_NoCollision, true);
+	newCable->bEnableStiffness = FirstCable->bEnableStiffness && !bUseSingleRope;
+	newCable->bUseSubstepping = !bUseSingleRope;
 
 	//Attach
 	newCable->bAttachEnd = true;
@@ -392,16 +464,387 @@ void UPS_HookComponent::SetupCableMaterial(UCableComponent* newCable) const
 	}
 }
 
+void UPS_HookComponent::ConfigCableAsRopeView(UCableComponent* cable) const
+{
+	if(!bUseSingleRope || !IsValid(cable)) return;
+
+	//Rope render and simulate, cables only hold the wrap points attachments (ends are read from them, not from particles)
+	cable->SetVisibility(false);
+	cable->SetComponentTickEnabled(false);
+	cable->NumSegments = 2;
+	cable->SolverIterations = 1;
+	cable->bEnableStiffness = false;
+	cable->bUseSubstepping = false;
+	cable->bSkipCableUpdateWhenNotVisible = true;
+}
+
+FVector UPS_HookComponent::GetCableStartLocation(const UCableComponent* cable)
+{
+	return IsValid(cable) ? cable->GetComponentLocation() : FVector::ZeroVector;
+}
+
+FVector UPS_HookComponent::GetCableEndLocation(const UCableComponent* cable)
+{
+	if(!IsValid(cable)) return FVector::ZeroVector;
+
+	//Same end as the cable simulation pins, without its particles
+	const USceneComponent* endComponent = cable->GetAttachedComponent();
+	if(!IsValid(endComponent)) endComponent = cable;
+
+	return endComponent->GetSocketTransform(cable->AttachEndToSocketName).TransformPosition(cable->EndLocation);
+}
+
+UCableComponent* UPS_HookComponent::GetCableAt(const int32 index) const
+{
+	if(index == 0) return FirstCable;
+	
+	return index > 0 && index <= _WrapChain.Num() ? _WrapChain[index - 1].Cable.Get() : nullptr;
+}
+
+void UPS_HookComponent::PushWrapPoint(const FPSCableWrapPoint& wrapPoint, const bool bFirst)
+{
+	if(bFirst) _WrapChain.PushFirst(wrapPoint);
+	else _WrapChain.PushLast(wrapPoint);
+
+	//Up to two wrap points, the other end segments go through the pushed one
+	ResetWrapChainQueries(bFirst, _WrapChain.Num() <= 2);
+}
+
+void UPS_HookComponent::PopWrapPoint(const bool bFirst)
+{
+	if(_WrapChain.IsEmpty()) return;
+
+	//Path of a wrap at this end was requested for the old chain, never matches again and is dropped once done
+	if(_PendingGeodesicKey.bByFirst == bFirst) _PendingGeodesicKey.WrapIndex = INDEX_NONE;
+
+	if(bFirst) _WrapChain.PopFirst();
+	else _WrapChain.PopLast();
+
+	ResetWrapChainQueries(bFirst, _WrapChain.Num() <= 1);
+}
+
+void UPS_HookComponent::ResetWrapChain()
+{
+	_WrapChain.Reset();
+	_PendingGeodesicKey.WrapIndex = INDEX_NONE;
+
+	ResetCableTraces();
+	for (FPSCableSweepState& sweepState : _CableSweepStates)
+	{
+		sweepState = FPSCableSweepState();
+	}
+}
+
+void UPS_HookComponent::ResetWrapChainQueries(const bool bFirst, const bool bBothEnds)
+{
+	if(bBothEnds || bFirst)
+	{
+		_CableTraces[static_cast<int32>(EPSCableTraceSlot::WrapByFirst)] = FPSCableTrace();
+		_CableTraces[static_cast<int32>(EPSCableTraceSlot::UnwrapByFirst)] = FPSCableTrace();
+		_CableSweepStates[1] = FPSCableSweepState();
+	}
+	if(bBothEnds || !bFirst)
+	{
+		_CableTraces[static_cast<int32>(EPSCableTraceSlot::WrapByLast)] = FPSCableTrace();
+		_CableTraces[static_cast<int32>(EPSCableTraceSlot::UnwrapByLast)] = FPSCableTrace();
+		_CableSweepStates[0] = FPSCableSweepState();
+	}
+}
+
+TArray<UCableComponent*> UPS_HookComponent::GetCableList() const
+{
+	TArray<UCableComponent*> cables;
+	cables.Reserve(GetCableCount());
+	for (int32 i = 0; i < GetCableCount(); i++)
+	{
+		cables.Add(GetCableAt(i));
+	}
+	return cables;
+}
+
+TArray<UCableComponent*> UPS_HookComponent::GetCableAttachedList() const
+{
+	//Each cable ending on a wrap point, the hook side one excluded
+	TArray<UCableComponent*> cables = GetCableList();
+	if(!cables.IsEmpty()) cables.Pop(EAllowShrinking::No);
+	return cables;
+}
+
+TArray<UStaticMeshComponent*> UPS_HookComponent::GetCableCapList() const
+{
+	TArray<UStaticMeshComponent*> caps;
+	caps.Reserve(_WrapChain.Num());
+	for (const FPSCableWrapPoint& wrapPoint : _WrapChain)
+	{
+		caps.Add(wrapPoint.Cap);
+	}
+	return caps;
+}
+
+void UPS_HookComponent::UpdateRope()
+{
+	if(!bUseSingleRope || !IsValid(Rope)) return;
+
+	if(!IsObjectHooked() || !IsValid(FirstCable))
+	{
+		Rope->ClearAnchors();
+		return;
+	}
+
+	//From attached object to hook : first cable end, then each cable start (wrap points then hook). Cables don't tick, anchors follow their attachments
+	TArray<FPSRopeAnchor> anchors;
+	anchors.Reserve(GetCableCount() + 1);
+	USceneComponent* attachedEnd = FirstCable->GetAttachedComponent();
+	anchors.Add({IsValid(attachedEnd) ? attachedEnd : FirstCable.Get(), FirstCable->AttachEndToSocketName, FirstCable->EndLocation});
+	anchors.Add({FirstCable, NAME_None});
+	for (const FPSCableWrapPoint& wrapPoint : _WrapChain)
+	{
+		if(!IsValid(wrapPoint.Cable))
+		{
+			Rope->ClearAnchors();
+			return;
+		}
+		anchors.Add({wrapPoint.Cable.Get(), NAME_None});
+	}
+
+	Rope->SetAnchors(anchors);
+
+	if(IsValid(_PlayerCharacter)) Rope->SetLODInputs(_AlphaTense, _PlayerCharacter->GetVelocity().Length());
+}
+
+void UPS_HookComponent::PrewarmCablePool()
+{
+	if(!IsValid(GetOwner())) return;
+
+	_FreeCablePool.Reserve(CablePoolPrewarmCount);
+	_FreeCapPool.Reserve(CablePoolPrewarmCount);
+	for (int32 i = 0; i < CablePoolPrewarmCount; i++)
+	{
+		UCableComponent* cable = CreatePooledCable();
+		if(IsValid(cable)) _FreeCablePool.Add(cable);
+
+		UStaticMeshComponent* cap = CreatePooledCap();
+		if(IsValid(cap)) _FreeCapPool.Add(cap);
+	}
+
+	UpdateCablePoolStats();
+	
+	if(bDebugCable) UE_LOG(LogTemp, Log, TEXT("%S :: cables %i, caps %i"), __FUNCTION__, _FreeCablePool.Num(), _FreeCapPool.Num());
+}
+
+UCableComponent* UPS_HookComponent::CreatePooledCable()
+{
+	if(!IsValid(GetOwner())) return nullptr;
+	
+	//Deferred so segments count is set before particles init on register
+	UCableComponent* newCable = Cast<UCableComponent>(GetOwner()->AddComponentByClass(UCableComponent::StaticClass(), false, FTransform(), true));
+	if(!IsValid(newCable)) return nullptr;
+	//Necessary for appear in BP
+	//GetOwner()->AddInstanceComponent(newCable);
+
+	//Config newCable
+	//-Material
+	//Debug Cable Color OR use FirstCable material
+	SetupCableMaterial(newCable);
+	
+	//Rendering
+	newCable->SetRenderCustomDepth(true);
+	newCable->SetCustomDepthStencilValue(200.0f);
+	newCable->SetCustomDepthStencilWriteMask(ERendererStencilMask::ERSM_Default);
+	newCable->SetReceivesDecals(false);
+
+	newCable->NumSegments = 10; // BE CAREFULL: num segment is involved in CableSocketEnd loc calculation need to stay superior of 1;
+	//newCable->MarkRenderStateDirty(); // Necessary for Update cable, otherwise can cause crash
+	
+	//Opti
+	newCable->bUseSubstepping = true;
+	newCable->bSkipCableUpdateWhenNotVisible = true;
+
+	//Collision
+	newCable->bEnableCollision = false;
+	newCable->SetCollisionProfileName(Profile_NoCollision, true);
+
+	ConfigCableAsRopeView(newCable);
+	
+	GetOwner()->FinishAddComponent(newCable, false, FTransform());
+
+	//Sleep until acquired
+	newCable->SetVisibility(false);
+	newCable->SetComponentTickEnabled(false);
+	
+	return newCable;
+}
+
+UStaticMeshComponent* UPS_HookComponent::CreatePooledCap()
+{
+	if(!IsValid(GetOwner())) return nullptr;
+	
+	UStaticMeshComponent* newCapMesh = Cast<UStaticMeshComponent>(GetOwner()->AddComponentByClass(UStaticMeshComponent::StaticClass(), true, FTransform(), false));
+	if (!IsValid(newCapMesh)) return nullptr;
+
+	//Set Mesh
+	if(IsValid(CapsMesh)) newCapMesh->SetStaticMesh(CapsMesh);
+	newCapMesh->SetCollisionProfileName(Profile_NoCollision);
+	newCapMesh->SetComponentTickEnabled(false);
+	
+	//Setup rendering settings
+	newCapMesh->SetRenderCustomDepth(true);
+	newCapMesh->SetCustomDepthStencilValue(200.0f);
+	newCapMesh->SetReceivesDecals(false);
+	newCapMesh->SetVisibility(false);
+	
+	//Get Cable Material and add to Cable
+	if(!bDebugMaterialColors)
+	{
+		if(IsValid(CableCapsMaterialInst))
+			newCapMesh->CreateDynamicMaterialInstance(0, CableCapsMaterialInst);
+	}
+
+	return newCapMesh;
+}
+
+UCableComponent* UPS_HookComponent::AcquireCable()
+{
+	UCableComponent* cable = nullptr;
+	while(!_FreeCablePool.IsEmpty() && !IsValid(cable))
+	{
+		cable = _FreeCablePool.Pop(EAllowShrinking::No);
+	}
+
+	if(IsValid(cable))
+	{
+		_CablePoolHits++;
+		INC_DWORD_STAT(STAT_HookCablePoolHits);
+	}
+	else
+	{
+		_CablePoolMisses++;
+		INC_DWORD_STAT(STAT_HookCablePoolMisses);
+		cable = CreatePooledCable();
+	}
+	UpdateCablePoolStats();
+	
+	if(!IsValid(cable)) return nullptr;
+
+	//Wake, rope views stay asleep
+	cable->SetComponentTickEnabled(!bUseSingleRope);
+	cable->SetVisibility(!bUseSingleRope);
+
+	if(bDebugCable) UE_LOG(LogTemp, Log, TEXT("%S :: hits %i, misses %i"), __FUNCTION__, _CablePoolHits, _CablePoolMisses);
+
+	return cable;
+}
+
+void UPS_HookComponent::ReleaseCable(UCableComponent* cable)
+{
+	//First cable is never pooled
+	if(!IsValid(cable) || cable == FirstCable) return;
+
+	cable->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+	cable->bAttachEnd = false;
+	cable->AttachEndTo = FComponentReference();
+	cable->SetVisibility(false);
+	cable->SetComponentTickEnabled(false);
+
+	_FreeCablePool.AddUnique(cable);
+	UpdateCablePoolStats();
+}
+
+UStaticMeshComponent* UPS_HookComponent::AcquireCap()
+{
+	UStaticMeshComponent* cap = nullptr;
+	while(!_FreeCapPool.IsEmpty() && !IsValid(cap))
+	{
+		cap = _FreeCapPool.Pop(EAllowShrinking::No);
+	}
+
+	if(IsValid(cap))
+	{
+		_CapPoolHits++;
+		INC_DWORD_STAT(STAT_HookCapPoolHits);
+	}
+	else
+	{
+		_CapPoolMisses++;
+		INC_DWORD_STAT(STAT_HookCapPoolMisses);
+		cap = CreatePooledCap();
+	}
+	UpdateCablePoolStats();
+
+	return cap;
+}
+
+void UPS_HookComponent::ReleaseCap(UStaticMeshComponent* cap)
+{
+	if(!IsValid(cap)) return;
+
+	cap->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+	cap->SetVisibility(false);
+
+	_FreeCapPool.AddUnique(cap);
+	UpdateCablePoolStats();
+}
+
+void UPS_HookComponent::ResetPooledCableParticles(UCableComponent* cable)
+{
+	//Rope views don't tick nor simulate, their particles are never read
+	if(bUseSingleRope || !IsValid(cable) || cable == FirstCable || !cable->IsRegistered()) return;
+
+	//Particles are private to the cable and only laid out on register, done once for the acquired cable, never on a live one
+	cable->ReregisterComponent();
+}
+
+void UPS_HookComponent::UpdateCablePoolStats() const
+{
+	const int32 cableRequests = _CablePoolHits + _CablePoolMisses;
+	const int32 capRequests = _CapPoolHits + _CapPoolMisses;
+	
+	SET_DWORD_STAT(STAT_HookCablePoolFree, _FreeCablePool.Num());
+	SET_DWORD_STAT(STAT_HookCapPoolFree, _FreeCapPool.Num());
+	SET_FLOAT_STAT(STAT_HookCablePoolHitRate, cableRequests > 0 ? 100.0f * _CablePoolHits / cableRequests : 100.0f);
+	SET_FLOAT_STAT(STAT_HookCapPoolHitRate, capRequests > 0 ? 100.0f * _CapPoolHits / capRequests : 100.0f);
+}
+
+void UPS_HookComponent::UpdateHookStats() const
+{
+	//Simulated segments: rope particles or every cable of the chain
+	int32 liveSegments = 0;
+	if(IsObjectHooked())
+	{
+		if(bUseSingleRope && IsValid(Rope))
+		{
+			liveSegments = FMath::Max(Rope->GetParticles().Num() - 1, 0);
+		}
+		else
+		{
+			for (int32 i = 0; i < GetCableCount(); i++)
+			{
+				const UCableComponent* cable = GetCableAt(i);
+				if(IsValid(cable)) liveSegments += cable->NumSegments;
+			}
+		}
+	}
+	const int32 liveCables = IsObjectHooked() ? GetCableCount() : 0;
+	const int32 liveCaps = _WrapChain.Num();
+
+	SET_DWORD_STAT(STAT_HookLiveCables, liveCables);
+	SET_DWORD_STAT(STAT_HookLiveCableSegments, liveSegments);
+	SET_DWORD_STAT(STAT_HookLiveCaps, liveCaps);
+
+	CSV_CUSTOM_STAT(Hook, LiveCables, liveCables, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(Hook, LiveCableSegments, liveSegments, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(Hook, LiveCaps, liveCaps, ECsvCustomStatOp::Set);
+}
+
 void UPS_HookComponent::WrapCableAddByFirst()
 {
+	HOOK_SCOPE(WrapByFirst);
+
 	if (_bWrappingByFirst) return;
 	
 	//-----Add Wrap Logic-----
 	//Add By First
-	const int32 firstIndex = 0;
-	if(!CableListArray.IsValidIndex(firstIndex) || CableListArray.IsEmpty()) return;
-	
-	UCableComponent* lastCable = CableListArray[firstIndex];
+	UCableComponent* lastCable = FirstCable;
 	if(!IsValid(lastCable)) return;
 
 	//Trace cable wrap
@@ -415,16 +858,13 @@ void UPS_HookComponent::WrapCableAddByFirst()
 	//If Location Already Exist return
 	if (!CheckPointLocation(currentTraceCableWrap.OutHit.Location, CableWrapErrorTolerance)) return;
 
-	//Create intermediate points
-	 // if (CableCapArray.IsValidIndex(firstIndex))
-	 // {
-	 // 	GenerateIntermediatePoint(CableCapArray[firstIndex]->GetComponentLocation(), currentTraceCableWrap.OutHit.Location, currentTraceCableWrap, bReverseLoc);
-	 // 	
-	 // }else
-	 // {
-	 // 	//Create end new point
-	 // 	CreateWrapPointByFirst(lastCable, currentTraceCableWrap);
-	 // }
+	//Around the mesh of the first wrap point, wrap along its surface. Delayed while the path is computed
+	const FPSCableWrapPoint* firstWrapPoint = _WrapChain.IsEmpty() ? nullptr : &_WrapChain.First();
+	if (firstWrapPoint && firstWrapPoint->Component == currentTraceCableWrap.OutHit.GetComponent() && IsValid(firstWrapPoint->Cap))
+	{
+		if (!GenerateIntermediatePoint(firstWrapPoint->Cap->GetComponentLocation(), currentTraceCableWrap, bReverseLoc)) return;
+		UpdateCableWrapExtremityLoc(lastCable, bReverseLoc, currentTraceCableWrap);
+	}
 	
 	//Create new point
 	CreateWrapPointByFirst(lastCable, currentTraceCableWrap);
@@ -433,10 +873,6 @@ void UPS_HookComponent::WrapCableAddByFirst()
 void UPS_HookComponent::CreateWrapPointByFirst(UCableComponent* const lastCable,const FSCableWrapParams& currentTraceCableWrap)
 {
 	//----Last Cable && New Points---
-	//Add new Point Loc && Hitted Component to Array
-	CablePointComponents.Insert(currentTraceCableWrap.OutHit.GetComponent(),0);
-	CablePointUnwrapAlphaArray.Insert(0.0f,0);
-		
 	//Config lastCable And Setup newCable
 	UCableComponent* newCable = nullptr;
 	ConfigLastAndSetupNewCable(lastCable, currentTraceCableWrap, newCable, true);
@@ -451,40 +887,46 @@ void UPS_HookComponent::CreateWrapPointByFirst(UCableComponent* const lastCable,
 	//----Caps Sphere---
 	//Add Sphere on Caps
 	if (bDebugCable) UE_LOG(LogTemp, Log, TEXT("%S :: AddSphereCaps"), __FUNCTION__);
-	AddSphereCaps(currentTraceCableWrap, true);
-	
-	//Add latest cable to attached cables array && Add this new cable to "cable list array"
-	if(CableAttachedArray.IsEmpty())
-		CableAttachedArray.Add(newCable);
-	else
-		CableAttachedArray.Insert(newCable,1);
-	CableListArray.Insert(newCable,1);
+	UStaticMeshComponent* newCap = AddSphereCaps(currentTraceCableWrap);
 
-	//Attach New Cable to Hitted Object && Set his position to it
-	if(!CableCapArray.IsValidIndex(1) || !CablePointComponents.IsValidIndex(1))
+	//Add new point in front of the chain, the new cable ends on it
+	FPSCableWrapPoint newWrapPoint;
+	newWrapPoint.Component = currentTraceCableWrap.OutHit.GetComponent();
+	newWrapPoint.Cap = newCap;
+	newWrapPoint.Cable = newCable;
+	PushWrapPoint(newWrapPoint, true);
+
+	//Attach New Cable to previous first point && Set his position to it, or to the hook if it was the only cable
+	if(_WrapChain.Num() > 1 && IsValid(_WrapChain[1].Cap) && IsValid(_WrapChain[1].Component))
 	{
-		_bWrappingByFirst = false;
-		return;
+		const FAttachmentTransformRules AttachmentRule = FAttachmentTransformRules(EAttachmentRule::KeepWorld, EAttachmentRule::KeepWorld, EAttachmentRule::KeepWorld, false);
+		newCable->SetWorldLocation(_WrapChain[1].Cap->GetComponentLocation());
+		newCable->AttachToComponent(_WrapChain[1].Component, AttachmentRule);
+	}
+	else
+	{
+		AttachCableToHookThrower(newCable);
 	}
-	const FAttachmentTransformRules AttachmentRule = FAttachmentTransformRules(EAttachmentRule::KeepWorld, EAttachmentRule::KeepWorld, EAttachmentRule::KeepWorld, false);
-	newCable->SetWorldLocation(CableCapArray[1]->GetComponentLocation());
-	newCable->AttachToComponent(CablePointComponents[1], AttachmentRule);
 	
 	//----Set New Cable Params identical to First Cable---
 	if (bCableUseSharedSettings) ConfigCableToFirstCableSettings(newCable);
 
+	ResetPooledCableParticles(newCable);
+
+	//Force update swing params on create caps if currently swinging
+	if (IsPlayerSwinging() && _PlayerCharacter->GetCharacterMovement()->IsFalling())
+		ForceUpdateMasterConstraint();
+
 	_bWrappingByFirst = false;
 }
 
 void UPS_HookComponent::WrapCableAddByLast()
 {
+	HOOK_SCOPE(WrapByLast);
+
 	if(_bArmIsRagdolled || _bWrappingByLast) return;
 	
-	int32 lastIndexCable = CableListArray.Num()-1;
-	
-	if(!CableListArray.IsValidIndex(lastIndexCable) || CableListArray.IsEmpty()) return;
-
-	UCableComponent* lastCable = CableListArray[lastIndexCable];
+	UCableComponent* lastCable = GetLastCable();
 	if(!IsValid(lastCable)) return;
 
 	//Trace cable wrap
@@ -495,17 +937,17 @@ void UPS_HookComponent::WrapCableAddByLast()
 	//If Trace Hit nothing or Invalid object return
 	if (!currentTraceCableWrap.OutHit.bBlockingHit || !IsValid(currentTraceCableWrap.OutHit.GetComponent())) return;
 	
-	// Create intermediate points
-	// const int32 lastIndexCablePoint = CableCapArray.Num() - 1;
-	// if (CableCapArray.IsValidIndex(lastIndexCablePoint))
-	// {		
-	// 	GenerateIntermediatePoint(CableCapArray[lastIndexCablePoint]->GetComponentLocation(), currentTraceCableWrap.OutHit.Location, currentTraceCableWrap, bReverseLoc);
-	// }
-	// else if (lastIndexCablePoint < 0)
-	// {
-	// 	//Create end point
-	// 	CreateNewCablePointByLast(lastCable, currentTraceCableWrap);
-	// }
+	//Around the mesh of the last wrap point, wrap along its surface. Delayed while the path is computed
+	const FPSCableWrapPoint* lastWrapPoint = _WrapChain.IsEmpty() ? nullptr : &_WrapChain.Last();
+	if (lastWrapPoint && lastWrapPoint->Component == currentTraceCableWrap.OutHit.GetComponent() && IsValid(lastWrapPoint->Cap))
+	{
+		if (!GenerateIntermediatePoint(lastWrapPoint->Cap->GetComponentLocation(), currentTraceCableWrap, bReverseLoc)) return;
+
+		//Intermediate points moved the chain end
+		lastCable = GetLastCable();
+		if(!IsValid(lastCable)) return;
+		UpdateCableWrapExtremityLoc(lastCable, bReverseLoc, currentTraceCableWrap);
+	}
 	
 	CreateNewCablePointByLast(lastCable, currentTraceCableWrap);
 }
@@ -519,11 +961,6 @@ void UPS_HookComponent::CreateNewCablePointByLast(UCableComponent* const lastCab
 	}
 	
 	//----Last Cable && New Points---
-	//Add new Point Loc && Hitted Component to Array
-	CableAttachedArray.Add(lastCable);
-	CablePointComponents.Add(currentTraceCableWrap.OutHit.GetComponent());
-	CablePointUnwrapAlphaArray.Add(0.0f);
-	
 	//Config lastCable And Setup newCable
 	UCableComponent* newCable = nullptr;
 	ConfigLastAndSetupNewCable(lastCable, currentTraceCableWrap, newCable, false);
@@ -538,10 +975,14 @@ void UPS_HookComponent::CreateNewCablePointByLast(UCableComponent* const lastCab
 	//----Caps Sphere---
 	//Add Sphere on Caps
 	if (bDebugCable) UE_LOG(LogTemp, Log, TEXT("%S :: AddSphereCaps"), __FUNCTION__);
-	AddSphereCaps(currentTraceCableWrap, false);
+	UStaticMeshComponent* newCap = AddSphereCaps(currentTraceCableWrap);
 	
-	//Add newCable to list
-	CableListArray.Add(newCable);
+	//Add new point at the end of the chain, the new cable ends on it
+	FPSCableWrapPoint newWrapPoint;
+	newWrapPoint.Component = currentTraceCableWrap.OutHit.GetComponent();
+	newWrapPoint.Cap = newCap;
+	newWrapPoint.Cable = newCable;
+	PushWrapPoint(newWrapPoint, false);
 	
 	//Attach New Cable to Hitted Object && Set his position to it
 	AttachCableToHookThrower(newCable);
@@ -549,28 +990,34 @@ void UPS_HookComponent::CreateNewCablePointByLast(UCableComponent* const lastCab
 	//----Set New Cable Params identical to First Cable---
 	if (bCableUseSharedSettings) ConfigCableToFirstCableSettings(newCable);
 
+	ResetPooledCableParticles(newCable);
+
+	//Force update swing params on create caps if currently swinging
+	if (IsPlayerSwinging() && _PlayerCharacter->GetCharacterMovement()->IsFalling())
+		ForceUpdateMasterConstraint();
+
 	_bWrappingByLast = false;
 	
 }
 
 void UPS_HookComponent::UnwrapCableByFirst()
 {
+	HOOK_SCOPE(UnwrapByFirst);
+
 	//-----Unwrap Logic-----
-	if(!CableListArray.IsValidIndex(1) || !CableListArray.IsValidIndex(0)) return;
+	if(_WrapChain.IsEmpty()) return;
 
-	UCableComponent* pastCable = CableListArray[1];
-	UCableComponent* currentCable = CableListArray[0];
+	FPSCableWrapPoint& firstWrapPoint = _WrapChain.First();
+	UCableComponent* pastCable = firstWrapPoint.Cable;
+	UCableComponent* currentCable = FirstCable;
  
 	if(!IsValid(currentCable) || !IsValid(pastCable) || currentCable == pastCable) return;
+
+	//No result yet can't be read as no hit
+	if(bAsyncCableTraces && !HasCableTraceResult(EPSCableTraceSlot::UnwrapByFirst)) return;
 	
 	//----Unwrap Trace-----
 	//If no hit, or hit very close to trace end then process unwrap
-	
-	if(!CablePointUnwrapAlphaArray.IsValidIndex(0))
-	{
-		UE_LOG(LogActorComponent, Error, TEXT("%S :: CablePointUnwrapAlphaArray[%i] Invalid"),__FUNCTION__, CablePointUnwrapAlphaArray.Num()-1);
-		return;
-	}
 
 	//Trace
 	FHitResult outHit;
@@ -578,7 +1025,7 @@ void UPS_HookComponent::UnwrapCableByFirst()
 	{
 		if(outHit.bBlockingHit && !outHit.Location.Equals(outHit.TraceEnd, CableUnwrapErrorMultiplier))
 		{
-			CablePointUnwrapAlphaArray[0] = 0.0f;
+			firstWrapPoint.UnwrapAlpha = 0.0f;
 			return;
 		}
 	}
@@ -586,79 +1033,58 @@ void UPS_HookComponent::UnwrapCableByFirst()
 
 	//----Custom tick-----
 	//Unwrap with delay frames to prevent flickering of wrap/unwrap cycles.Basically increase point alpha value by 1 each frame, if it's more than custom value then process. Use subtle values for responsive unwrap.
-	CablePointUnwrapAlphaArray[0] = CablePointUnwrapAlphaArray[0] + 1;
-	if(CablePointUnwrapAlphaArray[0] < CableUnwrapFirstFrameDelay)
+	firstWrapPoint.UnwrapAlpha = firstWrapPoint.UnwrapAlpha + 1;
+	if(firstWrapPoint.UnwrapAlpha < CableUnwrapFirstFrameDelay)
 	{
 		return;
 	}
 	
-	//Destroy and remove Last Cable tick
-	if(!CableListArray.IsValidIndex(1)
-		|| !CableCapArray.IsValidIndex(0)) return;
-	
-	//If attached cables are more than 0, remove the second one (when first cable gets closer to it)
-	CableAttachedArray.RemoveAt(CableAttachedArray.IsValidIndex(1) ? 1 : 0);
-	
-	//In any case, destroy the second cable (the first one is our main cable)
-	CableListArray[1]->DestroyComponent();
-
-	//Caps Sphere
-	CableCapArray[0]->DestroyComponent();
-	CableCapArray.RemoveAt(0);
+	//In any case, release the second cable (the first one is our main cable) && its Caps Sphere
+	ReleaseCable(firstWrapPoint.Cable);
+	ReleaseCap(firstWrapPoint.Cap);
 
 	//End Unwrap
-	CableListArray.RemoveAt(1);
-	CablePointComponents.RemoveAt(0);
-	CablePointUnwrapAlphaArray.RemoveAt(0);
+	PopWrapPoint(true);
 	
 	//----Set first cable Loc && Attach----
-	if(!CableListArray.IsValidIndex(0)) return;
-	UCableComponent* firstCable = CableListArray[0];
-	
-	if(CableCapArray.IsValidIndex(0) && IsValid(CableCapArray[0]))
+	if(!_WrapChain.IsEmpty() && IsValid(_WrapChain.First().Cap))
 	{
 		const FAttachmentTransformRules AttachmentRule = FAttachmentTransformRules(EAttachmentRule::KeepWorld, EAttachmentRule::KeepWorld, EAttachmentRule::KeepWorld, false);
 		
 		//Set the latest oldest point as cable active point && attach cable to the latest component point
-		firstCable->SetWorldLocation(CableCapArray[0]->GetComponentLocation(), false,nullptr, ETeleportType::TeleportPhysics);
-		firstCable->AttachToComponent(CablePointComponents[0],AttachmentRule);
+		FirstCable->SetWorldLocation(_WrapChain.First().Cap->GetComponentLocation(), false,nullptr, ETeleportType::TeleportPhysics);
+		FirstCable->AttachToComponent(_WrapChain.First().Component,AttachmentRule);
 	}
 	else
 	{
 		//Reset to base stiffness preset
-		firstCable->CableLength = _FirstCableDefaultLenght;
-		firstCable->bUseSubstepping = true;
+		FirstCable->CableLength = _FirstCableDefaultLenght;
+		FirstCable->bUseSubstepping = true;
 		
 		//Reset to HookAttach default set
-		AttachCableToHookThrower(firstCable);
+		AttachCableToHookThrower(FirstCable);
 	}
 }
 
 void UPS_HookComponent::UnwrapCableByLast()
 {
+	HOOK_SCOPE(UnwrapByLast);
+
 	//-----Unwrap Logic-----
-	//Init works Variables
-	int32 cableListLastIndex = CableListArray.Num()-1;
-	const int32 cableAttachedLastIndex = CableAttachedArray.Num()-1;
-	const int32 cablePointLocationsLastIndex = CablePointComponents.Num()-1;
-	
 	//Remove By Last
-	if(!CableAttachedArray.IsValidIndex(cableAttachedLastIndex) || !CableListArray.IsValidIndex(cableListLastIndex)) return;
+	if(_WrapChain.IsEmpty()) return;
 
-	UCableComponent* pastCable = CableAttachedArray[cableAttachedLastIndex];
-	UCableComponent* currentCable = CableListArray[cableListLastIndex];
+	FPSCableWrapPoint& lastWrapPoint = _WrapChain.Last();
+	UCableComponent* pastCable = GetCableAt(GetCableCount() - 2);
+	UCableComponent* currentCable = lastWrapPoint.Cable;
 	
 	if(!IsValid(currentCable) || !IsValid(pastCable) || currentCable == pastCable) return;
+
+	//No result yet can't be read as no hit
+	if(bAsyncCableTraces && !HasCableTraceResult(EPSCableTraceSlot::UnwrapByLast)) return;
 	
 	//----Unwrap Trace-----
-	//If no hit, or hit very close to trace end then process unwrap
-	
-	float cablePointUnwrapAlphaLastIndex = CablePointUnwrapAlphaArray.Num()-1;
-	if(!CablePointUnwrapAlphaArray.IsValidIndex(cablePointUnwrapAlphaLastIndex))
-	{
-		UE_LOG(LogActorComponent, Error, TEXT("%S :: CablePointUnwrapAlphaArray[%i] Invalid"),__FUNCTION__, CablePointUnwrapAlphaArray.Num()-1);
-		return;
-	}
+	//If no hit, or hit very close to trace end then process unwrap
 	
 	//Trace Unwrap
 	FHitResult outHit;
@@ -667,7 +1093,7 @@ void UPS_HookComponent::UnwrapCableByLast()
 	{
 		if(outHit.bBlockingHit && !outHit.Location.Equals(outHit.TraceEnd, CableUnwrapErrorMultiplier))
 		{
-			CablePointUnwrapAlphaArray[cablePointUnwrapAlphaLastIndex] = 0.0f;
+			lastWrapPoint.UnwrapAlpha = 0.0f;
 			return;
 		}
 
@@ -676,95 +1102,111 @@ void UPS_HookComponent::UnwrapCableByLast()
 	
 	//----Custom tick-----
 	//Unwrap with delay frames to prevent flickering of wrap/unwrap cycles.Basically increase point alpha value by 1 each frame, if it's more than custom value then process. Use subtle values for responsive unwrap.
-	CablePointUnwrapAlphaArray[cablePointUnwrapAlphaLastIndex] = CablePointUnwrapAlphaArray[cablePointUnwrapAlphaLastIndex] + 1;
-	if (CablePointUnwrapAlphaArray[cablePointUnwrapAlphaLastIndex] < CableUnwrapLastFrameDelay)
+	lastWrapPoint.UnwrapAlpha = lastWrapPoint.UnwrapAlpha + 1;
+	if (lastWrapPoint.UnwrapAlpha < CableUnwrapLastFrameDelay)
 		return;
 		
-	//----Destroy and remove Last Cable tick-----
-	if(!CableAttachedArray.IsValidIndex(0)
-		|| !CableAttachedArray.IsValidIndex(cableAttachedLastIndex)
-		|| !CableListArray.IsValidIndex(cableListLastIndex)
-		|| !CableCapArray.IsValidIndex(cablePointLocationsLastIndex)
-		|| !CablePointComponents.IsValidIndex(cablePointLocationsLastIndex)
-		|| !IsValid(CableCapArray[cablePointLocationsLastIndex])) return;
+	//----Release Last Cable && its Caps Sphere-----
+	if(!IsValid(lastWrapPoint.Cap)) return;
 	
-	//If attached cables are more than 0, remove the second one (when first cable gets closer to it)
-	CableAttachedArray.RemoveAt(cableAttachedLastIndex);	
-
-	//In any case, destroy the second cable (the first one is our main cable)
-	CableListArray[cableListLastIndex]->DestroyComponent();
-
-	//Caps Sphere	
-	CableCapArray[cablePointLocationsLastIndex]->DestroyComponent();
-	CableCapArray.RemoveAt(cablePointLocationsLastIndex);
+	ReleaseCable(lastWrapPoint.Cable);
+	ReleaseCap(lastWrapPoint.Cap);
 	
 	//End Unwrap
-	CableListArray.RemoveAt(cableListLastIndex);
-	CablePointComponents.RemoveAt(cablePointLocationsLastIndex);
-	CablePointUnwrapAlphaArray.RemoveAt(cablePointLocationsLastIndex);
+	PopWrapPoint(false);
 
 	//If Swinging reset linearZ
 	if (IsPlayerSwinging() && _PlayerCharacter->GetCharacterMovement()->IsFalling())
 		ForceUpdateMasterConstraint();	
 	
 	//----Set first cable Loc && Attach----
-	cableListLastIndex = CableListArray.Num() - 1;
-	if (!CableListArray.IsValidIndex(cableListLastIndex)) return;
-	UCableComponent* firstCable = CableListArray[cableListLastIndex];
-
 	//Reset to HookAttach default set
-	AttachCableToHookThrower(firstCable);
+	AttachCableToHookThrower(GetLastCable());
 }
 
-bool UPS_HookComponent::TraceCableUnwrap(const UCableComponent* pastCable, const UCableComponent* currentCable, const bool& bReverseLoc, FHitResult& outHit) const
+bool UPS_HookComponent::TraceCableUnwrap(const UCableComponent* pastCable, const UCableComponent* currentCable, const bool& bReverseLoc, FHitResult& outHit)
 {
-	const TArray<AActor*> actorsToIgnore = {GetOwner()};
-
-	const FVector pastCableStartSocketLoc = bReverseLoc ? pastCable->GetSocketLocation(SOCKET_CABLE_END) : pastCable->GetSocketLocation(SOCKET_CABLE_START);
-	const FVector pastCableEndSocketLoc = bReverseLoc ? pastCable->GetSocketLocation(SOCKET_CABLE_START) : pastCable->GetSocketLocation(SOCKET_CABLE_END);
+	if(bAsyncCableTraces)
+	{
+		if(!ConsumeCableTraceResult(bReverseLoc ? EPSCableTraceSlot::UnwrapByFirst : EPSCableTraceSlot::UnwrapByLast, outHit)) return false;
+	}
+	else
+	{
+		FVector start, end;
+		ComputeCableUnwrapTrace(pastCable, currentCable, bReverseLoc, start, end);
+		
+		HOOK_COUNT(CableTraces, 1);
+		GetWorld()->LineTraceSingleByChannel(outHit, start, end, ECC_Rope, _CableUnwrapTraceParams);
+	}
 
-	const FVector pastCableDirection = UKismetMathLibrary::GetForwardVector(UKismetMathLibrary::FindLookAtRotation(pastCableStartSocketLoc, pastCableEndSocketLoc));
+	if (!outHit.bBlockingHit || !IsValid(outHit.GetActor())) return false;
 	
-	const FVector start = bReverseLoc ? currentCable->GetSocketLocation(SOCKET_CABLE_END) : currentCable->GetSocketLocation(SOCKET_CABLE_START);
-	const FVector end = pastCableStartSocketLoc + pastCableDirection * CableUnwrapDistance;
+	//Find the closest loc on the actor hit collision
+	RefineCableUnwrapHit(outHit);
+	
+	return true;
+}
 
-	UKismetSystemLibrary::LineTraceSingle(GetWorld(), start, end, UEngineTypes::ConvertToTraceType(ECC_Rope),
-		false, actorsToIgnore, false ? EDrawDebugTrace::ForDuration : EDrawDebugTrace::None, outHit, true, bReverseLoc ? FColor::Cyan : FColor::Blue, FLinearColor::Green, 0.01f);
+void UPS_HookComponent::ComputeCableUnwrapTrace(const UCableComponent* pastCable, const UCableComponent* currentCable, const bool bReverseLoc, FVector& outStart, FVector& outEnd) const
+{
+	const FVector pastCableStartSocketLoc = bReverseLoc ? GetCableEndLocation(pastCable) : GetCableStartLocation(pastCable);
+	const FVector pastCableEndSocketLoc = bReverseLoc ? GetCableStartLocation(pastCable) : GetCableEndLocation(pastCable);
 
-	if (!outHit.bBlockingHit || !IsValid(outHit.GetActor())) return false;
+	const FVector pastCableDirection = (pastCableEndSocketLoc - pastCableStartSocketLoc).GetSafeNormal();
 	
-	//Find the closest loc on the actor hit collision
-	FVector outClosestPoint, outClosestTraceEnd;
+	outStart = bReverseLoc ? GetCableEndLocation(currentCable) : GetCableStartLocation(currentCable);
+	outEnd = pastCableStartSocketLoc + pastCableDirection * CableUnwrapDistance;
+}
 
-	UPSFl::FindClosestPointOnActor(outHit.GetActor(),outHit.Location, outClosestPoint);
-	if(!outClosestPoint.IsZero())
+void UPS_HookComponent::RefineCableUnwrapHit(FHitResult& outHit) const
+{
+	//Hit component only, instead of walking every mesh of the actor twice
+	const UPrimitiveComponent* hitComponent = outHit.GetComponent();
+	if(!IsValid(hitComponent)) return;
+	
+	FVector outClosestPoint, outClosestTraceEnd;
+	if(hitComponent->GetClosestPointOnCollision(outHit.Location, outClosestPoint) >= 0.0f && !outClosestPoint.IsZero())
 	{
 		outHit.Location = outClosestPoint;
 	}
 
-	UPSFl::FindClosestPointOnActor(outHit.GetActor(),outHit.TraceEnd, outClosestTraceEnd);
-	if(!outClosestTraceEnd.IsZero())
+	if(hitComponent->GetClosestPointOnCollision(outHit.TraceEnd, outClosestTraceEnd) >= 0.0f && !outClosestTraceEnd.IsZero())
 	{
 		outHit.TraceEnd = outClosestTraceEnd;
 	}
-	
-	return true;
 }
 
-void UPS_HookComponent::TraceCableWrap(const UCableComponent* cable, const bool bReverseLoc, FSCableWrapParams& outCableWarpParams) const
+void UPS_HookComponent::TraceCableWrap(const UCableComponent* cable, const bool bReverseLoc, FSCableWrapParams& outCableWarpParams)
 {
 	if (!IsValid(cable) || !IsValid(GetWorld())) return;
 
 	//If reverseLoc is true we trace Wrap by First
 	UpdateCableWrapExtremityLoc(cable, bReverseLoc, outCableWarpParams);
 
+	//Continuous test, corners crossed between two steps are caught too
+	if(bSweptCableWrap)
+	{
+		//Segment ends rest on the hooked mesh or the end wrap point component
+		const USceneComponent* endWrapComponent = _WrapChain.IsEmpty() ? nullptr : (bReverseLoc ? _WrapChain.First().Component : _WrapChain.Last().Component).Get();
+		const FPSCableSweepAnchors anchors = {bReverseLoc || _WrapChain.IsEmpty() ? _AttachedMesh : nullptr, endWrapComponent};
+		SweepCableWrap(outCableWarpParams.CableStart, outCableWarpParams.CableEnd, anchors, _CableSweepStates[bReverseLoc ? 1 : 0], outCableWarpParams.OutHit);
+		return;
+	}
+
+	//Last frame batch result
+	if(bAsyncCableTraces)
+	{
+		//No result reads as no hit, never as the previous one
+		if(!ConsumeCableTraceResult(bReverseLoc ? EPSCableTraceSlot::WrapByFirst : EPSCableTraceSlot::WrapByLast, outCableWarpParams.OutHit))
+			outCableWarpParams.OutHit = FHitResult();
+		return;
+	}
+
 	//Trace
-	FHitResult  outHit;
-	const TArray<AActor*> actorsToIgnore = {GetOwner()};
-	UKismetSystemLibrary::LineTraceSingle(GetWorld(), outCableWarpParams.CableStart, outCableWarpParams.CableEnd,
-		UEngineTypes::ConvertToTraceType(ECC_Rope),
-		true, actorsToIgnore, bDebugCable && !bReverseLoc ? EDrawDebugTrace::ForDuration : EDrawDebugTrace::None,
-		outHit, true, bReverseLoc ? FColor::Magenta : FColor::Purple, FLinearColor::Green, 0.01f);
+	FHitResult outHit;
+	HOOK_COUNT(CableTraces, 1);
+	GetWorld()->LineTraceSingleByChannel(outHit, outCableWarpParams.CableStart, outCableWarpParams.CableEnd, ECC_Rope, _CableWrapTraceParams);
+	if(bDebugCable && !bReverseLoc) DrawDebugLine(GetWorld(), outCableWarpParams.CableStart, outCableWarpParams.CableEnd, FColor::Purple, false, 0.01f);
 	
 	outCableWarpParams.OutHit = outHit;
 		
@@ -783,84 +1225,308 @@ void UPS_HookComponent::TraceCableWrap(const UCableComponent* cable, const bool
 	//if (outHit.bBlockingHit) _PlayerController->SetPause(true);
 }
 
+bool UPS_HookComponent::SweepCableWrap(const FVector& start, const FVector& end, const FPSCableSweepAnchors& anchors, FPSCableSweepState& sweepState, FHitResult& outHit) const
+{
+	outHit = FHitResult(start, end);
+
+	//First step of this segment sweeps nothing, only the current segment is tested
+	FPSCableSweepState previous = sweepState;
+	if(!previous.bValid)
+	{
+		previous.Start = start;
+		previous.End = end;
+	}
+	sweepState.Start = start;
+	sweepState.End = end;
+	sweepState.bValid = true;
+
+	//Broadphase, thin box in the swept quad plane. A world aligned box of the quad holds the floor && walls around the player almost every step
+	const FVector sweepDirection = (end - start).GetSafeNormal(UE_SMALL_NUMBER, FVector::ForwardVector);
+	FVector sweepNormal = ((end - previous.Start) ^ (start - previous.End)).GetSafeNormal();
+	if(sweepNormal.IsNearlyZero())
+	{
+		//Segment didn't move, the box is only around it
+		FVector unusedAxis;
+		sweepDirection.FindBestAxisVectors(unusedAxis, sweepNormal);
+	}
+	const FQuat sweptRotation = FRotationMatrix::MakeFromXZ(sweepDirection, sweepNormal).ToQuat();
+
+	const FVector sweptCorners[] = {previous.Start, previous.End, end, start};
+	FBox sweptLocalBounds(ForceInit);
+	for (const FVector& corner : sweptCorners)
+	{
+		sweptLocalBounds += sweptRotation.UnrotateVector(corner);
+	}
+	sweptLocalBounds = sweptLocalBounds.ExpandBy(1.0f);
+	
+	TArray<FOverlapResult> overlaps;
+	HOOK_COUNT(CableTraces, 1);
+	GetWorld()->OverlapMultiByChannel(overlaps, sweptRotation.RotateVector(sweptLocalBounds.GetCenter()), sweptRotation, ECC_Rope, FCollisionShape::MakeBox(sweptLocalBounds.GetExtent()), _CableWrapTraceParams);
+
+	//Earliest contact along the sweep wins, later candidates stop sampling past it
+	float firstContactAlpha = UE_BIG_NUMBER;
+	for (const FOverlapResult& overlap : overlaps)
+	{
+		UPrimitiveComponent* component = overlap.GetComponent();
+		if(!overlap.bBlockingHit || !IsValid(component)) continue;
+
+		//Always in the box as the segment rests on it, swept only when the current segment crosses new geometry on it
+		float contactAlpha;
+		FHitResult contactHit;
+		if(anchors.Contains(component))
+		{
+			HOOK_COUNT(CableTraces, 1);
+			if(!component->LineTraceComponent(contactHit, start, end, _CableWrapTraceParams)) continue;
+		}
+
+		if(!FindFirstSweptContact(component, previous, start, end, firstContactAlpha, contactAlpha, contactHit) || contactAlpha >= firstContactAlpha) continue;
+
+		firstContactAlpha = contactAlpha;
+		outHit = contactHit;
+	}
+
+	if(bDebugCable && outHit.bBlockingHit)
+	{
+		DrawDebugLine(GetWorld(), previous.Start, previous.End, FColor::Silver, false, 0.5f);
+		DrawDebugLine(GetWorld(), start, end, FColor::Purple, false, 0.5f);
+		DrawDebugPoint(GetWorld(), outHit.Location, 15.0f, FColor::Orange, false, 0.5f);
+	}
+	
+	return outHit.bBlockingHit;
+}
+
+bool UPS_HookComponent::FindFirstSweptContact(UPrimitiveComponent* component, const FPSCableSweepState& previous, const FVector& start, const FVector& end, const float maxAlpha, float& outAlpha, FHitResult& outHit) const
+{
+	int32 traceCount = 0;
+	auto traceSegmentAt = [&](const float alpha, FHitResult& hit)
+	{
+		traceCount++;
+		return component->LineTraceComponent(hit, FMath::Lerp(previous.Start, start, alpha), FMath::Lerp(previous.End, end, alpha), _CableWrapTraceParams);
+	};
+
+	//Coarse samples, previous segment is considered clear
+	float clearAlpha = 0.0f;
+	float blockedAlpha = -1.0f;
+	for (int32 i = 1; i <= SweptWrapSamples; i++)
+	{
+		const float alpha = static_cast<float>(i) / SweptWrapSamples;
+		if(traceSegmentAt(alpha, outHit))
+		{
+			blockedAlpha = alpha;
+			break;
+		}
+		clearAlpha = alpha;
+
+		//Clear up to an earlier contact of another candidate
+		if(clearAlpha >= maxAlpha) break;
+	}
+
+	if(blockedAlpha < 0.0f)
+	{
+		HOOK_COUNT(CableTraces, traceCount);
+		return false;
+	}
+
+	//Bisection to the first contact, hit is then on the edge the segment wraps around
+	FHitResult hit;
+	for (int32 i = 0; i < SweptWrapRefineIterations; i++)
+	{
+		const float alpha = (clearAlpha + blockedAlpha) * 0.5f;
+		if(traceSegmentAt(alpha, hit))
+		{
+			blockedAlpha = alpha;
+			outHit = hit;
+		}
+		else
+		{
+			clearAlpha = alpha;
+		}
+	}
+	HOOK_COUNT(CableTraces, traceCount);
+
+	outAlpha = blockedAlpha;
+	return outHit.bBlockingHit;
+}
+
+void UPS_HookComponent::InitCableTraceParams()
+{
+	//Built once, reused by every wrap && unwrap trace
+	_CableWrapTraceParams = FCollisionQueryParams(SCENE_QUERY_STAT(HookCableWrap), true, GetOwner());
+	_CableUnwrapTraceParams = FCollisionQueryParams(SCENE_QUERY_STAT(HookCableUnwrap), false, GetOwner());
+}
+
+void UPS_HookComponent::ConsumeCableTraces()
+{
+	if(!IsValid(GetWorld())) return;
+	
+	for (FPSCableTrace& cableTrace : _CableTraces)
+	{
+		if(!cableTrace.Handle.IsValid()) continue;
+
+		//Expired handle (request older than the last frame batch) is no result
+		FTraceDatum traceDatum;
+		cableTrace.bHasResult = GetWorld()->QueryTraceData(cableTrace.Handle, traceDatum);
+		cableTrace.Handle = FTraceHandle();
+		if(!cableTrace.bHasResult) continue;
+
+		cableTrace.Hit = traceDatum.OutHits.IsEmpty() ? FHitResult(traceDatum.Start, traceDatum.End) : traceDatum.OutHits[0];
+	}
+}
+
+bool UPS_HookComponent::ConsumeCableTraceResult(const EPSCableTraceSlot slot, FHitResult& outHit)
+{
+	FPSCableTrace& cableTrace = _CableTraces[static_cast<int32>(slot)];
+	if(!cableTrace.bHasResult) return false;
+
+	//Used once, the next read waits for a new request
+	outHit = cableTrace.Hit;
+	cableTrace.bHasResult = false;
+	return true;
+}
+
+void UPS_HookComponent::RequestCableTraces()
+{
+	UWorld* world = GetWorld();
+	if(!IsValid(world)) return;
+
+	auto requestTrace = [this, world](const EPSCableTraceSlot slot, const FVector& start, const FVector& end, const FCollisionQueryParams& params)
+	{
+		_CableTraces[static_cast<int32>(slot)].Handle = world->AsyncLineTraceByChannel(EAsyncTraceType::Single, start, end, ECC_Rope, params);
+		HOOK_COUNT(CableTraces, 1);
+	};
+
+	//Wrap, last cable from hook side && first cable from attached object side (swept wrap queries itself)
+	FSCableWrapParams wrapParams;
+	if(!bSweptCableWrap && IsValid(GetLastCable()))
+	{
+		UpdateCableWrapExtremityLoc(GetLastCable(), false, wrapParams);
+		requestTrace(EPSCableTraceSlot::WrapByLast, wrapParams.CableStart, wrapParams.CableEnd, _CableWrapTraceParams);
+		if(bDebugCable) DrawDebugLine(world, wrapParams.CableStart, wrapParams.CableEnd, FColor::Purple, false, 0.01f);
+	}
+	if(!bSweptCableWrap && IsValid(FirstCable))
+	{
+		UpdateCableWrapExtremityLoc(FirstCable, true, wrapParams);
+		requestTrace(EPSCableTraceSlot::WrapByFirst, wrapParams.CableStart, wrapParams.CableEnd, _CableWrapTraceParams);
+	}
+	
+	//Unwrap, only when there is a wrap point
+	if(_WrapChain.IsEmpty()) return;
+
+	FVector start, end;
+	const UCableComponent* pastLastCable = GetCableAt(GetCableCount() - 2);
+	const UCableComponent* lastCable = GetLastCable();
+	if(IsValid(pastLastCable) && IsValid(lastCable))
+	{
+		ComputeCableUnwrapTrace(pastLastCable, lastCable, false, start, end);
+		requestTrace(EPSCableTraceSlot::UnwrapByLast, start, end, _CableUnwrapTraceParams);
+	}
+
+	const UCableComponent* pastFirstCable = _WrapChain.First().Cable;
+	if(IsValid(pastFirstCable) && IsValid(FirstCable))
+	{
+		ComputeCableUnwrapTrace(pastFirstCable, FirstCable, true, start, end);
+		requestTrace(EPSCableTraceSlot::UnwrapByFirst, start, end, _CableUnwrapTraceParams);
+	}
+}
+
+void UPS_HookComponent::ResetCableTraces()
+{
+	for (FPSCableTrace& cableTrace : _CableTraces)
+	{
+		cableTrace = FPSCableTrace();
+	}
+}
+
 void UPS_HookComponent::UpdateCableWrapExtremityLoc(const UCableComponent* cable, bool bReverseLoc,
 	FSCableWrapParams& outCableWarpParams)
 {
-	FVector start = cable->GetSocketLocation(SOCKET_CABLE_START);
-	FVector end = cable->GetSocketLocation(SOCKET_CABLE_END);
+	FVector start = GetCableStartLocation(cable);
+	FVector end = GetCableEndLocation(cable);
 
 	outCableWarpParams.CableStart = bReverseLoc ? end : start;
 	outCableWarpParams.CableEnd = bReverseLoc ? start : end;
 }
 
-void UPS_HookComponent::AddSphereCaps(const FSCableWrapParams& currentTraceParams, const bool bIsAddByFirst)
+UStaticMeshComponent* UPS_HookComponent::AddSphereCaps(const FSCableWrapParams& currentTraceParams)
 {	
 	FVector rotatedCapTowardTarget = UKismetMathLibrary::GetUpVector(UKismetMathLibrary::FindLookAtRotation(currentTraceParams.CableStart,currentTraceParams.OutHit.Location));
 	const FTransform& capsRelativeTransform = FTransform(rotatedCapTowardTarget.Rotation(),currentTraceParams.OutHit.Location,UKismetMathLibrary::Conv_DoubleToVector(FirstCable->CableWidth * CapsScaleMultiplicator));
 	
-	//Add new Cap Sphere (sphere size should be like 0.0105 of cable to fit)
-	UStaticMeshComponent* newCapMesh = Cast<UStaticMeshComponent>(GetOwner()->AddComponentByClass(UStaticMeshComponent::StaticClass(), true, capsRelativeTransform,false));
+	//Reuse a pooled Cap Sphere (sphere size should be like 0.0105 of cable to fit)
+	UStaticMeshComponent* newCapMesh = AcquireCap();
 	if (!IsValid(newCapMesh))
 	{
 		UE_LOG(LogActorComponent, Error, TEXT("PS_HookComponent :: newCapMesh Invalid"));
-		return;
+		return nullptr;
 	}
 
-	//Set Mesh && Attach Cap to Hitted Object
-	if(IsValid(CapsMesh)) newCapMesh->SetStaticMesh(CapsMesh);
-	newCapMesh->SetCollisionProfileName(Profile_NoCollision);
-	newCapMesh->SetComponentTickEnabled(false);
-
-	//Set loc and scale
-	newCapMesh->SetWorldLocation(currentTraceParams.OutHit.Location);
+	//Set loc and scale && Attach Cap to Hitted Object
+	newCapMesh->SetWorldTransform(capsRelativeTransform);
 	newCapMesh->AttachToComponent(currentTraceParams.OutHit.GetComponent(), FAttachmentTransformRules::KeepWorldTransform);
-	
-	//Setup rendering settings
-	newCapMesh->SetRenderCustomDepth(true);
-	newCapMesh->SetCustomDepthStencilValue(200.0f);
-	newCapMesh->SetReceivesDecals(false);
-	
-	//Get Cable Material and add to Cable
-	if(!bDebugMaterialColors)
-	 {
-	 	if(IsValid(CableCapsMaterialInst))
-	 		newCapMesh->CreateDynamicMaterialInstance(0, CableCapsMaterialInst);
-	 }
-
-	//Add to list
-	if(bIsAddByFirst)
-		CableCapArray.Insert(newCapMesh,0);
-	else
-		CableCapArray.Add(newCapMesh);
-	
-	//Force update swing params on create caps if currently swinging
-	if (IsPlayerSwinging() && _PlayerCharacter->GetCharacterMovement()->IsFalling())
-		ForceUpdateMasterConstraint();
+	newCapMesh->SetVisibility(!bUseSingleRope);
+
+
+	return newCapMesh;
 }
 
 bool UPS_HookComponent::CheckPointLocation(const FVector& targetLoc, const float& errorTolerance)
 {
 	bool bLocalPointFound = false;
-	for (UStaticMeshComponent* cableCapElement : CableCapArray)
+	for (const FPSCableWrapPoint& wrapPoint : _WrapChain)
 	{
-		if(!IsValid(cableCapElement)) continue;
+		if(!IsValid(wrapPoint.Cap)) continue;
 		
-		if(cableCapElement->GetComponentLocation().Equals(targetLoc, errorTolerance)) bLocalPointFound = true;
+		if(wrapPoint.Cap->GetComponentLocation().Equals(targetLoc, errorTolerance)) bLocalPointFound = true;
 	}	
 	return !bLocalPointFound;
 }
 
-void UPS_HookComponent::GenerateIntermediatePoint(const FVector& lastPointLoc, const FVector& newPointLoc, FSCableWrapParams& currentTraceCableWrap, const bool bReverseLoc)
+bool UPS_HookComponent::GenerateIntermediatePoint(const FVector& lastPointLoc, FSCableWrapParams& currentTraceCableWrap, const bool bReverseLoc)
 {
+	HOOK_SCOPE(GenerateIntermediatePoint);
+
 	UMeshComponent* meshComp = Cast<UMeshComponent>(currentTraceCableWrap.OutHit.GetComponent());
-	if (!IsValid(meshComp)) return;
+	if (!IsValid(meshComp)) return true;
+
+	const FVector newPointLoc = currentTraceCableWrap.OutHit.Location;
 
 	//Compute Path
 	TArray<FVector> outPoints;
-	//UPSFL_GeometryScript::ComputeGeodesicPath(meshComp, newPointLoc, lastPointLoc, outPoints, false, bDebugGeodesic);
-	UPSFL_GeometryScript::ComputeGeodesicPathWithVelocity(meshComp, newPointLoc, lastPointLoc, _PlayerCharacter->GetCapsuleVelocity(), outPoints, 0.5, false, bDebugGeodesic);
+	UPS_GeometryQuerySubsystem* geometryQuerySubsystem = GetWorld()->GetSubsystem<UPS_GeometryQuerySubsystem>();
+	if (bAsyncGeodesic && !bDebugGeodesic && IsValid(geometryQuerySubsystem))
+	{
+		//Stable while this chain end waits on this mesh, hit endpoints move every frame while swinging
+		const FPSGeodesicWrapKey geodesicKey = {meshComp, GetWrapPointCount(), bReverseLoc};
+
+		//Finished path of another wrap is dropped
+		if (_PendingGeodesicPath.IsValid() && _PendingGeodesicPath.IsReady() && !(_PendingGeodesicKey == geodesicKey)) _PendingGeodesicPath.Reset();
+
+		//Single request in flight, another wrap meanwhile goes on without intermediate points
+		if (_PendingGeodesicPath.IsValid() && !(_PendingGeodesicKey == geodesicKey)) return true;
+
+		if (!_PendingGeodesicPath.IsValid())
+		{
+			HOOK_COUNT(GeodesicQueries, 1);
+			_PendingGeodesicPath = geometryQuerySubsystem->RequestGeodesicPath(meshComp, newPointLoc, lastPointLoc, _PlayerCharacter->GetCapsuleVelocity(), 0.5f);
+			_PendingGeodesicKey = geodesicKey;
+			_PendingGeodesicFrame = GFrameCounter;
+		}
+
+		//Wrap waits a few frames for its path, then goes on without it (request stays in flight until done)
+		if (!_PendingGeodesicPath.IsReady()) return GFrameCounter - _PendingGeodesicFrame > static_cast<uint64>(GeodesicMaxWaitFrames);
+
+		const FPSGeodesicPathResult& result = _PendingGeodesicPath.Get();
+		if (result.bSuccess) outPoints = result.Points;
+		_PendingGeodesicPath.Reset();
+	}
+	else
+	{
+		//UPSFL_GeometryScript::ComputeGeodesicPath(meshComp, newPointLoc, lastPointLoc, outPoints, false, bDebugGeodesic);
+		HOOK_COUNT(GeodesicQueries, 1);
+		UPSFL_GeometryScript::ComputeGeodesicPathWithVelocity(meshComp, newPointLoc, lastPointLoc, _PlayerCharacter->GetCapsuleVelocity(), outPoints, 0.5, false, bDebugGeodesic);
+	}
 	
-	if (outPoints.Num() == 	currentTraceCableWrap.outPoints.Num()) return;
+	if (outPoints.IsEmpty()) return true;
 
 	if (bDebugCable)
 	{
@@ -868,22 +1534,20 @@ void UPS_HookComponent::GenerateIntermediatePoint(const FVector& lastPointLoc, c
 		DrawDebugPoint(GetWorld(), newPointLoc, 20.f,bReverseLoc ? FColor::FromHex(FString("#990000")) : FColor::Red, false, 1.0f);
 	}
 
-	if (bDebugCable) UE_LOG(LogTemp, Log, TEXT("%S"), __FUNCTION__);
+	if (bDebugCable) UE_LOG(LogTemp, Log, TEXT("%S :: %i points"), __FUNCTION__, outPoints.Num());
 	
-	//Geodesic intermediate points
+	//Geodesic intermediate points, path runs from the new hit to the chain end so they are created from the chain end
 	FSCableWrapParams intermediateCableWrapParams = currentTraceCableWrap;
-	for (int i = outPoints.Num() - 1; i >= 0; i--)
+	for (int32 i = outPoints.Num() - 1; i >= 0; i--)
 	{
-		FVector intermediatePoint = outPoints[i];
-		
-		//Update index and LastCable
-		const int32 indexCable = bReverseLoc ? 0 : CableListArray.Num()-1;
+		const FVector& intermediatePoint = outPoints[i];
+
+		//Path ends are the mesh vertices nearest to both wrap points
+		if (FVector::Distance(intermediatePoint, newPointLoc) < CableWrapErrorTolerance || !CheckPointLocation(intermediatePoint, CableWrapErrorTolerance)) continue;
 		
-		if(!CableListArray.IsValidIndex(indexCable)) return;
-	
-		UCableComponent* cable = CableListArray[indexCable];
-	
-		if(!IsValid(cable)) return;
+		//Update LastCable
+		UCableComponent* cable = bReverseLoc ? FirstCable : GetLastCable();
+		if(!IsValid(cable)) break;
 		
 		//Update wrap params
 		UpdateCableWrapExtremityLoc(cable, bReverseLoc, intermediateCableWrapParams);
@@ -894,48 +1558,49 @@ void UPS_HookComponent::GenerateIntermediatePoint(const FVector& lastPointLoc, c
 			CreateWrapPointByFirst(cable, intermediateCableWrapParams);
 		else
 			CreateNewCablePointByLast(cable, intermediateCableWrapParams);
-		
 	}
-	currentTraceCableWrap.outPoints = outPoints;
-	
+	currentTraceCableWrap.outPoints = MoveTemp(outPoints);
+
+	return true;
 }
 
 void UPS_HookComponent::AdaptCableTense(const float alphaTense)
 {
-	const int32 lastIndex = CableListArray.Num() - 1;
-
-	if(!CableListArray.IsValidIndex(lastIndex)) return;
+	const int32 cableCount = GetCableCount();
 		
+	//Same length ratio for a span in both modes, depth from the hook side
+	_SpanLengthRatios.SetNumUninitialized(cableCount, EAllowShrinking::No);
+	for (int32 i = 0; i < cableCount; i++)
+	{
+		const float alphaDepth = alphaTense / (cableCount - i);
+		_SpanLengthRatios[i] = FMath::Lerp(CableMaxLengthMultiplicator, 1.0f / CableMinLengthDivider, alphaDepth);
+	}
+
+	//Single rope receive the ratios, its LOD handles segments, iterations and sleep. View cables keep their minimal settings
+	if(bUseSingleRope)
+	{
+		if(IsValid(Rope)) Rope->SetSpanLengthRatios(_SpanLengthRatios);
+		if (bDebugPull) UE_LOG(LogActorComponent, Log, TEXT("%S :: alphaTense %f"),__FUNCTION__, alphaTense); 
+		return;
+	}
+
 	//CableLength iterate from last(characterCable) to last +
-	int32 index = 1;
-	for (int i = lastIndex; i >= 0; i--)
+	for (int32 i = 0; i < cableCount; i++)
 	{
-		if(!CableListArray.IsValidIndex(i) || !IsValid(CableListArray[i]) )
-		{
-			index++;
-			continue;
-		}
+		UCableComponent* cable = GetCableAt(i);
+		if(!IsValid(cable)) continue;
 		
 		//Solver
-		const float start = CableSolverRange.Max;
-		const float end = CableSolverRange.Min;
-		const int32 newSolverIterations = FMath::InterpStep(start, end, alphaTense / index, CableSolverRange.Max);
-		if(CableListArray[i]->SolverIterations != newSolverIterations) CableListArray[i]->SolverIterations = newSolverIterations;
+		const float alphaDepth = alphaTense / (cableCount - i);
+		const int32 newSolverIterations = FMath::InterpStep(CableSolverRange.Max, CableSolverRange.Min, alphaDepth, CableSolverRange.Max);
+		if(cable->SolverIterations != newSolverIterations) cable->SolverIterations = newSolverIterations;
 
 		//Lenght
-		const float distBetCable = FMath::Abs(UKismetMathLibrary::Vector_Distance(CableListArray[i]->GetSocketLocation(SOCKET_CABLE_START),CableListArray[i]->GetSocketLocation(SOCKET_CABLE_END)));
-		
-		const float min = distBetCable / CableMinLengthDivider;
-		const float max = distBetCable * CableMaxLengthMultiplicator;
-		const float newLenght = FMath::Lerp(max, min, (alphaTense / index));
-
-		//UE_LOG(LogActorComponent, Error, TEXT("%S :: index %i, distBetCable %f, max %f min %f, newLenght %f, solverIterations %i"),__FUNCTION__, i,distBetCable, max,min, newLenght, newSolverIterations); 
-		
-		CableListArray[i]->CableLength = newLenght;
+		const float distBetCable = FVector::Distance(GetCableStartLocation(cable), GetCableEndLocation(cable));
+		cable->CableLength = distBetCable * _SpanLengthRatios[i];
 
-		//Iterate
-		index++;
-	}; 
+		//UE_LOG(LogActorComponent, Error, TEXT("%S :: index %i, distBetCable %f, ratio %f, solverIterations %i"),__FUNCTION__, i, distBetCable, spanLengthRatios[i], newSolverIterations); 
+	}
 
 	if (bDebugPull) UE_LOG(LogActorComponent, Log, TEXT("%S :: alphaTense %f"),__FUNCTION__, alphaTense); 
 }
@@ -978,6 +1643,7 @@ void UPS_HookComponent::HookObject()
 	
 	//Define new attached component
 	_AttachedMesh = Cast<UMeshComponent>(_CurrentHookHitResult.GetComponent());
+	_AttachedMesh->OnComponentPhysicsStateChanged.AddUniqueDynamic(this, &UPS_HookComponent::OnAttachedMeshPhysicsStateChanged);
 
 	//Attach First cable to it
 	//----Setup First Cable---
@@ -989,12 +1655,13 @@ void UPS_HookComponent::HookObject()
 	FirstCable->SetCollisionProfileName(Profile_NoCollision, true);
 	FirstCable->bEnableCollision = false;
 	FirstCable->SetAllPhysicsLinearVelocity(FVector::ZeroVector);
-	FirstCable->SetVisibility(true);
+	FirstCable->SetVisibility(!bUseSingleRope);
+	if(bUseSingleRope) Rope->SetVisibility(true);
 
 	//Check if it's a destructible and use Chaos logic if it is;
 	if(_CurrentHookHitResult.GetComponent()->IsA(UGeometryCollectionComponent::StaticClass()))
 	{
-		if(!IsValid(_ImpactField)) GenerateImpactField(_CurrentHookHitResult,  FVector::One());
+		if(!IsImpactFieldActive()) GenerateImpactField(_CurrentHookHitResult,  FVector::One());
 	}
 	//Else setup new attached component and collision
 	else
@@ -1038,24 +1705,16 @@ void UPS_HookComponent::DettachHook()
 	_AttachedMesh->SetLinearDamping(0.01f);
 	_AttachedMesh->SetAngularDamping(0.0f);
 	_AttachedMesh->SetCollisionProfileName(Profile_GPE, false);
+	_AttachedMesh->OnComponentPhysicsStateChanged.RemoveDynamic(this, &UPS_HookComponent::OnAttachedMeshPhysicsStateChanged);
 	_AttachedMesh = nullptr;
+	PublishPullCommand(FPSHookPullCommand());
 			
 	//----Clear Cable Warp ---
-	//Destroy Cable
-	for (UCableComponent* cable : CableListArray)
-	{
-		if(!IsValid(cable)) continue;
-		
-		//Prevent to Destroy FirstCable
-		if(cable != FirstCable) cable->DestroyComponent();		
-	}
-
-	//Destroy Caps
-	for (UStaticMeshComponent* currentCap : CableCapArray)
+	//Release Cable && Caps to pool (FirstCable is never released)
+	for (const FPSCableWrapPoint& wrapPoint : _WrapChain)
 	{
-		if(!IsValid(currentCap)) continue;
-		
-		currentCap->DestroyComponent();
+		ReleaseCable(wrapPoint.Cable);
+		ReleaseCap(wrapPoint.Cap);
 	}
 
 	//reset FirstCable stiffness
@@ -1063,15 +1722,8 @@ void UPS_HookComponent::DettachHook()
 	FirstCable->SolverIterations = 1.0f;
 	FirstCable->bUseSubstepping = true; 
 
-	//Reset CableList && CableCapArray
-	CableListArray.Empty();
-	CableListArray.AddUnique(FirstCable);
-	CableCapArray.Empty();
-	
-	//Clear all other Array
-	CableAttachedArray.Empty();
-	CablePointUnwrapAlphaArray.Empty();
-	CablePointComponents.Empty();
+	//Reset wrap chain
+	ResetWrapChain();
 
 	
 	//----Setup First Cable---
@@ -1080,6 +1732,8 @@ void UPS_HookComponent::DettachHook()
 	FirstCable->bAttachEnd = false;
 	FirstCable->AttachEndTo = FComponentReference();
 	FirstCable->SetVisibility(false);
+	Rope->ClearAnchors();
+	Rope->SetVisibility(false);
 	FirstCable->SetCollisionProfileName(Profile_NoCollision, true);
 
 	//Chaos field system rest
@@ -1178,10 +1832,10 @@ void UPS_HookComponent::Unblock(FVector& outEnd)
 {
 	if(_bAttachObjectIsBlocked)
 	{
-		if (CableListArray.IsValidIndex(1) && CablePointComponents.IsValidIndex(1))
+		if (_WrapChain.Num() > 1 && IsValid(_WrapChain[1].Component))
 		{
 			FVector outClosestPoint;
-			UPSFl::FindClosestPointOnActor(CablePointComponents[1]->GetOwner(), _UnwrapLastLocation, outClosestPoint);
+			UPSFl::FindClosestPointOnActor(_WrapChain[1].Component->GetOwner(), _UnwrapLastLocation, outClosestPoint);
 			if (!outClosestPoint.IsZero())
 			{
 				outEnd = outClosestPoint;
@@ -1324,7 +1978,7 @@ void UPS_HookComponent::DetermineForceWeight(const float alpha)
 
 	//CableCaps num PullForce bonus
 	const float alphaMass = UKismetMathLibrary::MapRangeClamped(objectMassScaled, playerMassScaled, playerMassScaled * MaxPullWeight, 1.0f, 0.0f);
-	const float capsBonus = ForceCapsWeight * CableCapArray.Num();
+	const float capsBonus = ForceCapsWeight * GetWrapPointCount();
 	float forceWeight = FMath::Lerp(0.0f, MaxForceWeight + capsBonus, alphaMass);
 	forceWeight = FMath::Clamp(forceWeight, 0.0f,ForceWeightMaxThreshold);
 	
@@ -1360,7 +2014,7 @@ float UPS_HookComponent::CalculatePullAlpha(const float baseToMeshDist)
 	
 	//Distance On Attach By point number weight
 	const float max = FMath::Max(_DistanceOnAttach + CablePullSlackMaxDistanceRange, _DistanceOnAttach - CablePullSlackMaxDistanceRange);
-	float distanceOnAttachByTensorWeight = CableCapArray.Num() > 1 ? FMath::Clamp(UKismetMathLibrary::SafeDivide(_DistanceOnAttach + _CablePullSlackDistance, CableCapArray.Num()), 0.0f, max) : 0.0f;
+	float distanceOnAttachByTensorWeight = GetWrapPointCount() > 1 ? FMath::Clamp(UKismetMathLibrary::SafeDivide(_DistanceOnAttach + _CablePullSlackDistance, GetWrapPointCount()), 0.0f, max) : 0.0f;
 	
 	//Calculate Pull alpha && activate pull
 	const float baseToMeshTotalDist = baseToMeshDist + distanceOnAttachByTensorWeight;
@@ -1421,17 +2075,26 @@ void UPS_HookComponent::ForceDettachByFall()
 
 void UPS_HookComponent::PowerCablePull()
 {
+	HOOK_SCOPE(PowerCablePull);
+
+	//Physics steps stop pulling unless this frame fills a new command
+	FPSHookPullCommand pullCommand;
+	ON_SCOPE_EXIT
+	{
+		if(bCanUseSubstepTick) PublishPullCommand(pullCommand);
+	};
+
 	if (!IsValid(_PlayerCharacter)
 		|| !IsValid(_AttachedMesh)
-		|| !CableListArray.IsValidIndex(0)
-		|| !CableListArray.IsValidIndex(CableListArray.Num() - 1)
+		|| !IsValid(FirstCable)
+		|| !IsValid(GetLastCable())
 		|| !IsValid(GetWorld()))
 		return;
 
 	//Determine Alphas
 	//Current dist to attach loc
-	float armToMeshDist = FMath::Abs(UKismetMathLibrary::Vector_Distance(HookThrower->GetSocketLocation(SOCKET_HOOK), CableListArray[CableListArray.Num() - 1]->GetSocketLocation(SOCKET_CABLE_END)));
-	float baseToMeshDist = FMath::Abs(UKismetMathLibrary::Vector_Distance(_PlayerCharacter->GetActorLocation(), CableListArray[CableListArray.Num() - 1]->GetSocketLocation(SOCKET_CABLE_END)));
+	float armToMeshDist = FMath::Abs(UKismetMathLibrary::Vector_Distance(HookThrower->GetSocketLocation(SOCKET_HOOK), GetCableEndLocation(GetLastCable())));
+	float baseToMeshDist = FMath::Abs(UKismetMathLibrary::Vector_Distance(_PlayerCharacter->GetActorLocation(), GetCableEndLocation(GetLastCable())));
 	
 	//Calculate current pull alpha (Winde && Distance Pull)
 	_AlphaPull = CalculatePullAlpha(baseToMeshDist);
@@ -1469,21 +2132,37 @@ void UPS_HookComponent::PowerCablePull()
 	float currentPushAccel = _ForceWeight;
 	
 	//Pull direction calculation 
-	FVector start = CableListArray[0]->GetSocketLocation(SOCKET_CABLE_END);
-	FVector end =  CableListArray[0]->GetSocketLocation(SOCKET_CABLE_START);
+	FVector start = GetCableEndLocation(FirstCable);
+	FVector end =  GetCableStartLocation(FirstCable);
 
 	//Blocked Pull Force
 	//Unblock(end);
 	
 	//Default Pull Force
 	FRotator rotMeshCable = UKismetMathLibrary::FindLookAtRotation(start,end);		
-	
-	//Object isn't blocked add a random range offset
-	rotMeshCable.Yaw = rotMeshCable.Yaw + UKismetMathLibrary::RandomFloatInRange(-PullingMaxRandomYawOffset, PullingMaxRandomYawOffset);
 	//if(_bAttachObjectIsBlocked) currentPushAccel = (currentPushAccel / UnblockDefaultPullforceDivider);
+
+	if(bCanUseSubstepTick)
+	{
+		//Same dilation compensation as AddImpulseDilated, random yaw is drawn at each physics step
+		const float globalDilation = UGameplayStatics::GetGlobalTimeDilation(GetWorld());
+		const float ownerDilation = _AttachedMesh->GetOwner()->CustomTimeDilation;
+		const float dilatedTime = ownerDilation <= 0.0f ? globalDilation : (globalDilation / ownerDilation);
+
+		pullCommand.bActive = true;
+		pullCommand.PhysicsHandle = _AttachedMesh->GetBodyInstance() ? _AttachedMesh->GetBodyInstance()->GetPhysicsActorHandle() : nullptr;
+		pullCommand.Direction = rotMeshCable.Vector();
+		pullCommand.Acceleration = currentPushAccel / FMath::Max(dilatedTime, KINDA_SMALL_NUMBER);
+		pullCommand.MaxRandomYawOffset = PullingMaxRandomYawOffset;
+	}
+	else
+	{
+		//Object isn't blocked add a random range offset
+		rotMeshCable.Yaw = rotMeshCable.Yaw + UKismetMathLibrary::RandomFloatInRange(-PullingMaxRandomYawOffset, PullingMaxRandomYawOffset);
 	
-	FVector defaultNewVel = (_AttachedMesh->GetMass() *  rotMeshCable.Vector() * currentPushAccel) * GetWorld()->DeltaTimeSeconds;
-	UPSFl::AddImpulseDilated(this, _AttachedMesh, defaultNewVel);
+		FVector defaultNewVel = (_AttachedMesh->GetMass() *  rotMeshCable.Vector() * currentPushAccel) * GetWorld()->DeltaTimeSeconds;
+		UPSFl::AddImpulseDilated(this, _AttachedMesh, defaultNewVel);
+	}
 	
 	//Debug base Pull dir
 	if(bDebugPull)
@@ -1493,6 +2172,39 @@ void UPS_HookComponent::PowerCablePull()
 	
 }
 
+void UPS_HookComponent::PublishPullCommand(const FPSHookPullCommand& command)
+{
+	FScopeLock lock(&_PullCommandLock);
+	_PullCommand = command;
+}
+
+void UPS_HookComponent::OnAttachedMeshPhysicsStateChanged(UPrimitiveComponent* changedComponent, EComponentPhysicsStateChange stateChange)
+{
+	//Removal reaches the solver after this, next steps read the cleared command. Recreated body is resolved by the next PowerCablePull
+	if(stateChange == EComponentPhysicsStateChange::Destroyed) PublishPullCommand(FPSHookPullCommand());
+}
+
+void UPS_HookComponent::ApplyPullCommand(const float deltaTime)
+{
+	FPSHookPullCommand pullCommand;
+	{
+		FScopeLock lock(&_PullCommandLock);
+		pullCommand = _PullCommand;
+	}
+
+	if(!pullCommand.bActive || !pullCommand.PhysicsHandle || deltaTime <= 0.0f) return;
+
+	Chaos::FRigidBodyHandle_Internal* rigidHandle = pullCommand.PhysicsHandle->GetPhysicsThreadAPI();
+	if(!rigidHandle || rigidHandle->ObjectState() != Chaos::EObjectStateType::Dynamic) return;
+
+	//Random range offset per step
+	FRotator pullRot = pullCommand.Direction.Rotation();
+	pullRot.Yaw += _PhysicsRandomStream.FRandRange(-pullCommand.MaxRandomYawOffset, pullCommand.MaxRandomYawOffset);
+
+	//Force integrated over the step, impulse per second doesn't depend on frame or step rate
+	rigidHandle->AddForce(rigidHandle->M() * pullRot.Vector() * pullCommand.Acceleration);
+}
+
 void UPS_HookComponent::OnPushTimerEndEventReceived(const FTimerHandle selfHandler, const FVector& currentPushDir, const float pushAccel)
 {
 	if(!IsValid(_AttachedMesh) || !IsValid(GetWorld())) return;
@@ -1533,17 +2245,38 @@ void UPS_HookComponent::OnTriggerSwing(const bool bActivate)
 	//_PlayerCharacter->GetCharacterMovement()->GravityScale = bActivate ? SwingGravityScale : _DefaultGravityScale;
 	_PlayerCharacter->GetCharacterMovement()->AirControl = bActivate ? SwingMaxAirControl : _PlayerCharacter->GetDefaultAirControl();
 	_PlayerCharacter->GetCharacterMovement()->BrakingDecelerationFalling = 400.0f;
+
+	//Pendulum integrated in player movement, no constraint rig
+	if(IsAnalyticSwing())
+	{
+		UPS_CharacterMovementComponent* movementComponent = _PlayerCharacter->GetPSCharacterMovement();
+		if(!IsValid(movementComponent)) return;
+
+		if(bActivate)
+		{
+			//Start at current dist to avoid snap, OnAnalyticSwingPhysic interp to free length
+			const FVector pivotLoc = GetSwingPivotLocation();
+			_SwingLastDistOnAttachWithRange = FMath::Max(GetSwingFreeRopeLength(), FVector::Distance(pivotLoc, _PlayerCharacter->GetActorLocation()));
+			movementComponent->StartSwing(pivotLoc, _SwingLastDistOnAttachWithRange);
+		}
+		else
+		{
+			_ForceWeight = 0.0f;
+			movementComponent->StopSwing();
+		}
+		return;
+	}
 	
 	if (bActivate)
 	{
-		const bool bMustAttachtoLastPoint = CablePointComponents.IsValidIndex(0);
+		const bool bMustAttachtoLastPoint = !_WrapChain.IsEmpty() && IsValid(_WrapChain.First().Component) && IsValid(_WrapChain.First().Cap);
 		
 		ConstraintAttachSlave->SetMassOverrideInKg(NAME_None, _PlayerCharacter->GetCharacterMovement()->Mass);
 		ConstraintAttachMaster->SetMassOverrideInKg(NAME_None, _AttachedMesh->GetMass());
 
-		UCableComponent* cableToAdapt = IsValid(CableListArray.Last()) ? CableListArray.Last() : FirstCable;
-		AActor* masterAttachActor = bMustAttachtoLastPoint ? CablePointComponents[0]->GetOwner() : _PlayerCharacter;
-		FVector masterLoc = bMustAttachtoLastPoint && CableCapArray.IsValidIndex(0) ? CableCapArray[0]->GetComponentLocation() : _CurrentHookHitResult.Location;
+		UCableComponent* cableToAdapt = IsValid(GetLastCable()) ? GetLastCable() : FirstCable;
+		AActor* masterAttachActor = bMustAttachtoLastPoint ? _WrapChain.First().Component->GetOwner() : _PlayerCharacter;
+		FVector masterLoc = bMustAttachtoLastPoint ? _WrapChain.First().Cap->GetComponentLocation() : _CurrentHookHitResult.Location;
 		ConstraintAttachMaster->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
 		
 		HookPhysicConstraint->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
@@ -1558,7 +2291,7 @@ void UPS_HookComponent::OnTriggerSwing(const bool bActivate)
 			HookPhysicConstraint->ConstraintActor2 = masterAttachActor;
 
 			HookPhysicConstraint->ComponentName1.ComponentName = FName(GetConstraintAttachSlave()->GetName());
-			HookPhysicConstraint->ComponentName2.ComponentName = CablePointComponents.IsValidIndex(0) ?FName(CablePointComponents[0]->GetName()) : FName(GetConstraintAttachMaster()->GetName());
+			HookPhysicConstraint->ComponentName2.ComponentName = bMustAttachtoLastPoint ? FName(_WrapChain.First().Component->GetName()) : FName(GetConstraintAttachMaster()->GetName());
 			//HookPhysicConstraint->ComponentName2.ComponentName = FName(ConstraintAttachMaster->GetName());
 
 			//Set Linear Limit
@@ -1569,7 +2302,7 @@ void UPS_HookComponent::OnTriggerSwing(const bool bActivate)
 			
 			//Setup AttachMaster
 			ConstraintAttachMaster->SetCollisionEnabled(ECollisionEnabled::PhysicsOnly);
-			if(bMustAttachtoLastPoint) ConstraintAttachMaster->AttachToComponent(CableCapArray[0], FAttachmentTransformRules::SnapToTargetNotIncludingScale);
+			if(bMustAttachtoLastPoint) ConstraintAttachMaster->AttachToComponent(_WrapChain.First().Cap, FAttachmentTransformRules::SnapToTargetNotIncludingScale);
 			ConstraintAttachMaster->SetWorldLocation(masterLoc);
 			ConstraintAttachMaster->SetWorldRotation(FRotator::ZeroRotator);
 
@@ -1579,7 +2312,7 @@ void UPS_HookComponent::OnTriggerSwing(const bool bActivate)
 			ConstraintAttachSlave->SetWorldLocation(HookThrower->GetComponentLocation());
 			
 			//Setup hookconstraint Loc && Rot
-			if(bMustAttachtoLastPoint) HookPhysicConstraint->AttachToComponent(CableCapArray[0], FAttachmentTransformRules::SnapToTargetNotIncludingScale);
+			if(bMustAttachtoLastPoint) HookPhysicConstraint->AttachToComponent(_WrapChain.First().Cap, FAttachmentTransformRules::SnapToTargetNotIncludingScale);
 			HookPhysicConstraint->SetRelativeTransform(FTransform(FRotator::ZeroRotator, FVector::ZeroVector, FVector(1.0f)));
 			HookPhysicConstraint->SetWorldLocation(GetConstraintAttachMaster()->GetComponentLocation(), false);
 			
@@ -1637,7 +2370,7 @@ void UPS_HookComponent::OnTriggerSwing(const bool bActivate)
 
 void UPS_HookComponent::SwingTick(const float deltaTime)
 {
-	if(!IsValid(_PlayerCharacter) || !IsValid(_PlayerCharacter->GetCharacterMovement()) || !IsValid(_AttachedMesh) || !CableListArray.IsValidIndex(0) || !IsValid(GetWorld())) return;
+	if(!IsValid(_PlayerCharacter) || !IsValid(_PlayerCharacter->GetCharacterMovement()) || !IsValid(_AttachedMesh) || !IsValid(FirstCable) || !IsValid(GetWorld())) return;
 			
 	//Activate Swing if not active
 	if(!IsPlayerSwinging() && _PlayerCharacter->GetCharacterMovement()->IsFalling() && _AttachedMesh->GetMass() > _PlayerCharacter->GetMesh()->GetMass())
@@ -1655,6 +2388,14 @@ void UPS_HookComponent::SwingTick(const float deltaTime)
 
 void UPS_HookComponent::OnSwingPhysic(const float deltaTime)
 {
+	HOOK_SCOPE(SwingPhysic);
+
+	if(IsAnalyticSwing())
+	{
+		OnAnalyticSwingPhysic(deltaTime);
+		return;
+	}
+
 	if(_PlayerCharacter->GetCharacterMovement()->IsMovingOnGround()
 	  || _PlayerCharacter->GetParkourComponent()->IsWallRunning()
 	  || _PlayerCharacter->GetParkourComponent()->IsLedging()
@@ -1697,11 +2438,9 @@ void UPS_HookComponent::OnSwingPhysic(const float deltaTime)
 	 // }
 		
 	//Move physic constraint to match player position (attached element) && //Update constraint position on component
-	const float lastIndex = CableCapArray.Num() - 1;
-
 	//Update Attach and Constraint physic loc
-	const bool lastCablePointIsValid = CableCapArray.IsValidIndex(lastIndex);
-	ConstraintAttachMaster->SetWorldLocation(lastCablePointIsValid ? CableCapArray[lastIndex]->GetComponentLocation() : _CurrentHookHitResult.Location);
+	const bool lastCablePointIsValid = !_WrapChain.IsEmpty() && IsValid(_WrapChain.Last().Cap);
+	ConstraintAttachMaster->SetWorldLocation(lastCablePointIsValid ? _WrapChain.Last().Cap->GetComponentLocation() : _CurrentHookHitResult.Location);
 	FVector constraintLoc = GetConstraintAttachMaster()->GetComponentLocation();
 	if(!FMath::IsNearlyEqual(HookPhysicConstraint->GetComponentLocation().Length(),constraintLoc.Length())) HookPhysicConstraint->SetWorldLocation(constraintLoc, false);
 
@@ -1782,8 +2521,11 @@ void UPS_HookComponent::OnSwingPhysic(const float deltaTime)
 
 void UPS_HookComponent::ForceUpdateMasterConstraint()
 {
+	//Pivot already followed each movement step
+	if(IsAnalyticSwing()) return;
+
 	if(bDebugSwing) UE_LOG(LogActorComponent, Log, TEXT("%S"),__FUNCTION__);
-	const bool bMustAttachtoLastPoint = CablePointComponents.IsValidIndex(0);
+	const bool bMustAttachtoLastPoint = !_WrapChain.IsEmpty() && IsValid(_WrapChain.First().Cap);
 	_bUpdateMasterContraintByTime = !bMustAttachtoLastPoint;
 	
 	//Attachment
@@ -1792,12 +2534,12 @@ void UPS_HookComponent::ForceUpdateMasterConstraint()
 	
 	if(bMustAttachtoLastPoint)
 	{
-		ConstraintAttachMaster->AttachToComponent(CableCapArray[0], FAttachmentTransformRules::SnapToTargetNotIncludingScale);
-		HookPhysicConstraint->AttachToComponent(CableCapArray[0], FAttachmentTransformRules::SnapToTargetNotIncludingScale);
+		ConstraintAttachMaster->AttachToComponent(_WrapChain.First().Cap, FAttachmentTransformRules::SnapToTargetNotIncludingScale);
+		HookPhysicConstraint->AttachToComponent(_WrapChain.First().Cap, FAttachmentTransformRules::SnapToTargetNotIncludingScale);
 	}
 
 	//Update dist && Move
-	FVector masterLoc = bMustAttachtoLastPoint && CableCapArray.IsValidIndex(0) ? CableCapArray[0]->GetComponentLocation() : _CurrentHookHitResult.Location;
+	FVector masterLoc = bMustAttachtoLastPoint ? _WrapChain.First().Cap->GetComponentLocation() : _CurrentHookHitResult.Location;
 	UpdateMasterConstraint(masterLoc);
 
 	//Activate Custom tick Update
@@ -1837,6 +2579,60 @@ void UPS_HookComponent::ImpulseConstraintAttach() const
 	if(bDebugSwing) UE_LOG(LogActorComponent, Warning, TEXT("%S"), __FUNCTION__);
 }
 
+void UPS_HookComponent::OnAnalyticSwingPhysic(const float deltaTime)
+{
+	UPS_CharacterMovementComponent* movementComponent = _PlayerCharacter->GetPSCharacterMovement();
+
+	//Swing mode left by land, jump or launch
+	if(!IsValid(movementComponent)
+	  || !movementComponent->IsSwinging()
+	  || _PlayerCharacter->GetParkourComponent()->IsWallRunning()
+	  || _PlayerCharacter->GetParkourComponent()->IsLedging()
+	  || _PlayerCharacter->GetParkourComponent()->IsMantling())
+	{
+		OnTriggerSwing(false);
+		return;
+	}
+
+	//Wrap && winde change free length, smoothed like the constraint rig
+	const float freeLength = GetSwingFreeRopeLength();
+	_SwingLastDistOnAttachWithRange = UKismetMathLibrary::FInterpTo(_SwingLastDistOnAttachWithRange, freeLength, deltaTime, SwingWindeTargetLocInterpSpeed);
+	movementComponent->SetSwingConstraint(GetSwingPivotLocation(), _SwingLastDistOnAttachWithRange);
+
+	if(bDebugSwing)
+	{
+		DrawDebugSphere(GetWorld(), movementComponent->GetSwingPivot(), movementComponent->GetSwingRopeLength(), 16, FColor::Green, false, -1.0f);
+		UE_LOG(LogActorComponent, Log, TEXT("%S :: freeLength %f, ropeLength %f"), __FUNCTION__, freeLength, _SwingLastDistOnAttachWithRange);
+	}
+}
+
+FVector UPS_HookComponent::GetSwingPivotLocation() const
+{
+	if(!_WrapChain.IsEmpty() && IsValid(_WrapChain.Last().Cap)) return _WrapChain.Last().Cap->GetComponentLocation();
+
+	return IsValid(FirstCable) ? GetCableEndLocation(FirstCable) : _CurrentHookHitResult.Location;
+}
+
+float UPS_HookComponent::GetSwingFreeRopeLength() const
+{
+	const float ropeLength = _DistanceOnAttach + _CablePullSlackDistance;
+	if(_WrapChain.IsEmpty() || !IsValid(FirstCable)) return FMath::Max(ropeLength, 0.0f);
+
+	//Spans from attached object to last wrap point are fixed around the geometry
+	float wrappedLength = 0.0f;
+	FVector lastLoc = GetCableEndLocation(FirstCable);
+	for (int32 i = 0; i < _WrapChain.Num(); i++)
+	{
+		if(!IsValid(_WrapChain[i].Cap)) continue;
+
+		const FVector pointLoc = _WrapChain[i].Cap->GetComponentLocation();
+		wrappedLength += FVector::Distance(lastLoc, pointLoc);
+		lastLoc = pointLoc;
+	}
+
+	return FMath::Max(ropeLength - wrappedLength, 0.0f);
+}
+
 //------------------
 #pragma endregion Swing
 
@@ -1861,26 +2657,17 @@ void UPS_HookComponent::GenerateImpactField(const FHitResult& targetHit, const F
 	}
 	
 	//Work var
-	const bool bMustAttachtoLastPoint = CablePointComponents.IsValidIndex(0);
-	FVector masterLoc = bMustAttachtoLastPoint && CableCapArray.IsValidIndex(0) ? CableCapArray[0]->GetComponentLocation() : _CurrentHookHitResult.Location;
+	const bool bMustAttachtoLastPoint = !_WrapChain.IsEmpty() && IsValid(_WrapChain.First().Cap);
+	FVector masterLoc = bMustAttachtoLastPoint ? _WrapChain.First().Cap->GetComponentLocation() : _CurrentHookHitResult.Location;
 	
-	//Spawn param
-	FActorSpawnParameters SpawnInfo;
-	SpawnInfo.Owner = _PlayerCharacter;
-	SpawnInfo.Instigator = _PlayerCharacter;
-	SpawnInfo.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-
 	//Spawn Rotation
 	const FVector dir = _PlayerCharacter->GetFirstPersonCameraComponent()->GetForwardVector() * 100;
 	FRotator rot = UKismetMathLibrary::FindLookAtRotation(targetHit.ImpactPoint, targetHit.ImpactPoint - dir);
 	rot.Pitch = rot.Pitch - 90.0f;
 		
-	_ImpactField = GetWorld()->SpawnActor<APS_FieldSystemActor>(FieldSystemActor.Get(), masterLoc, rot, SpawnInfo);
+	_ImpactField = AcquireImpactField(FTransform(rot, masterLoc, extent), _PlayerCharacter);
 	
 	if(!IsValid(_ImpactField) || !IsValid(_ImpactField->GetCollider())) return;
-
-	//Setup spawned elements
-	_ImpactField->SetActorScale3D(extent);
 	
 	//Bind to EndOverlap && BreakEvent for destroying
 	_ImpactField->GetCollider()->OnComponentEndOverlap.AddUniqueDynamic(this, &UPS_HookComponent::OnChaosFieldEndOverlapEventReceived);
@@ -1912,8 +2699,9 @@ void UPS_HookComponent::ResetImpactField(const bool bForce)
 	//Reset variables
 	_bCanMoveField = false;
 
-	//And for end destroy current impact field
-	_ImpactField->Destroy();
+	//And for end return current impact field to the pool
+	ReleaseImpactField(_ImpactField);
+	_ImpactField = nullptr;
 
 	//DettachHook if still attach
 	if(IsValid(_AttachedMesh))DettachHook();
@@ -4,19 +4,31 @@
 
 #include "CoreMinimal.h"
 #include "InputAction.h"
+#include "Containers/Deque.h"
 #include "Components/BoxComponent.h"
 #include "PhysicsEngine/PhysicalAnimationComponent.h"
 #include "PhysicsEngine/PhysicsConstraintComponent.h"
 #include "ProjectSlice/Components/GPE/PS_FieldSystemActor.h"
 #include "ProjectSlice/Data/PS_Delegates.h"
 #include "ProjectSlice/Interface/PS_CanGenerateImpactField.h"
+#include "ProjectSlice/System/PS_GeometryQuerySubsystem.h"
+#include "PS_RopeComponent.h"
 #include "PS_HookComponent.generated.h"
 
+DECLARE_STATS_GROUP(TEXT("Hook"), STATGROUP_Hook, STATCAT_Advanced);
+
 
 class AProjectSlicePlayerController;
 class UCableComponent;
 class AProjectSliceCharacter;
 
+UENUM(BlueprintType)
+enum class ESwingMode : uint8
+{
+	PHYSIC_CONSTRAINT = 0 UMETA(DisplayName = "Physic constraint"),
+	ANALYTIC = 1 UMETA(DisplayName = "Analytic"),
+};
+
 USTRUCT(BlueprintType, Category = "Struct")
 struct FSCableWrapParams
 {
@@ -40,6 +52,88 @@ public:
 	TArray<FVector> outPoints;
 };
 
+// Pull state published by the game thread, applied at each physics step
+struct FPSHookPullCommand
+{
+	bool bActive = false;
+
+	// Resolved from the body instance each frame, cleared as soon as the body is destroyed
+	FPhysicsActorHandle PhysicsHandle = nullptr;
+
+	FVector Direction = FVector::ZeroVector;
+
+	// cm/s², already divided by the attached object dilation
+	float Acceleration = 0.0f;
+
+	float MaxRandomYawOffset = 0.0f;
+};
+
+// Wrap and unwrap queries batched each frame
+enum class EPSCableTraceSlot : uint8
+{
+	WrapByLast,
+	WrapByFirst,
+	UnwrapByLast,
+	UnwrapByFirst,
+	Count
+};
+
+struct FPSCableTrace
+{
+	FTraceHandle Handle;
+
+	FHitResult Hit;
+
+	// Result of the previous frame request, cleared once read and when the wrap chain changes
+	bool bHasResult = false;
+};
+
+// Cable segment at the previous wrap step, start of the swept surface
+struct FPSCableSweepState
+{
+	FVector Start = FVector::ZeroVector;
+
+	FVector End = FVector::ZeroVector;
+
+	bool bValid = false;
+};
+
+// Components a swept cable segment rests on at its ends
+struct FPSCableSweepAnchors
+{
+	const USceneComponent* HookedComponent = nullptr;
+
+	const USceneComponent* WrapComponent = nullptr;
+
+	bool Contains(const USceneComponent* component) const { return component == HookedComponent || component == WrapComponent; }
+};
+
+// Wrap point of the cable chain, its cable ends on it and starts on the next point (or the hook for the last one)
+struct FPSCableWrapPoint
+{
+	TObjectPtr<USceneComponent> Component = nullptr;
+
+	TObjectPtr<UStaticMeshComponent> Cap = nullptr;
+
+	TObjectPtr<UCableComponent> Cable = nullptr;
+
+	// Frames without blocking hit before unwrapping
+	float UnwrapAlpha = 0.0f;
+};
+
+// Wrap an async geodesic path is computed for, stable while the wrap waits (hit endpoints move every frame)
+struct FPSGeodesicWrapKey
+{
+	TWeakObjectPtr<UMeshComponent> Component;
+
+	// Wrap points count when requested
+	int32 WrapIndex = INDEX_NONE;
+
+	bool bByFirst = false;
+
+	bool operator==(const FPSGeodesicWrapKey& Other) const { return Component == Other.Component && WrapIndex == Other.WrapIndex && bByFirst == Other.bByFirst; }
+};
+
 UCLASS(Blueprintable, BlueprintType, ClassGroup=(Component), meta=(BlueprintSpawnableComponent))
 class PROJECTSLICE_API UPS_HookComponent : public USceneComponent, public IPS_CanGenerateImpactField
 {
@@ -54,6 +148,9 @@ class PROJECTSLICE_API UPS_HookComponent : public USceneComponent, public IPS_Ca
 	UPROPERTY(VisibleAnywhere, Category="Component", meta = (AllowPrivateAccess = "true"))
 	UCableComponent* FirstCable = nullptr;
 
+	UPROPERTY(VisibleAnywhere, Category="Component", meta = (AllowPrivateAccess = "true"))
+	UPS_RopeComponent* Rope = nullptr;
+
 	UPROPERTY(VisibleInstanceOnly, Category="Component", meta = (AllowPrivateAccess = "true"))
 	UPhysicsConstraintComponent* HookPhysicConstraint = nullptr;
 
@@ -75,6 +172,12 @@ public:
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType,
 		FActorComponentTickFunction* ThisTickFunction) override;
 
+	// Physics thread when physics ticks async, else game thread once per physics step
+	virtual void AsyncPhysicsTickComponent(float DeltaTime, float SimTime) override;
+
+	// Wrap chain is not reflected
+	static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
+
 	/** Returns HookThrowerComp subobject **/
 	UFUNCTION(BlueprintCallable)
 	FORCEINLINE USkeletalMeshComponent* GetHookThrower() const { return HookThrower; }
@@ -85,6 +188,9 @@ public:
 	UFUNCTION(BlueprintCallable)
 	FORCEINLINE UCableComponent* GetFirstCable() const { return FirstCable; }
 
+	UFUNCTION(BlueprintCallable)
+	FORCEINLINE UPS_RopeComponent* GetRope() const { return Rope; }
+
 	/** Returns Swing system ConstraintAttachSlave subobject **/
 	FORCEINLINE UStaticMeshComponent* GetConstraintAttachSlave() const { return ConstraintAttachSlave; }
 
@@ -196,28 +302,34 @@ public:
 	UFUNCTION(BlueprintCallable)
 	FORCEINLINE float GetAlphaPull() const{return _AlphaPull;}
 
-protected:
-	//Status	
-	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category="Status|Cable|Rope",
-		meta=(ToolTip="Cable list array, each added cable including the first one will be stored here"))
-	TArray<UCableComponent*> CableListArray;
+	// Wrap points from the attached object to the hook
+	FORCEINLINE const TDeque<FPSCableWrapPoint>& GetWrapChain() const { return _WrapChain; }
+
+	UFUNCTION(BlueprintCallable)
+	FORCEINLINE int32 GetWrapPointCount() const { return _WrapChain.Num(); }
 
-	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category="Status|Cable|Rope",
-		meta=(ToolTip="Attached cables array, each attached cable point will be stored here."))
-	TArray<UCableComponent*> CableAttachedArray;
+	// First cable then one cable per wrap point
+	UFUNCTION(BlueprintCallable)
+	FORCEINLINE int32 GetCableCount() const { return _WrapChain.Num() + 1; }
 
-	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category="Status|Cable|Cable",
-		meta=(ToolTip="Cable caps array, each added cap will be stored here"))
-	TArray<UStaticMeshComponent*> CableCapArray;
+	UFUNCTION(BlueprintCallable)
+	UCableComponent* GetCableAt(const int32 index) const;
 
-	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category="Status|Cable|Point",
-		meta=(ToolTip="Cable points array, each hit component with the location will be stored here."))
-	TArray<USceneComponent*> CablePointComponents;
-	
-	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category="Status|Cable|Point",
-		meta=(ToolTip="Cable points alphas, alpha value to detach for each point."))
-	TArray<float> CablePointUnwrapAlphaArray;
+	UFUNCTION(BlueprintCallable)
+	FORCEINLINE UCableComponent* GetLastCable() const { return GetCableAt(GetCableCount() - 1); }
+
+	// Read only views of the wrap chain, built on call
+	UFUNCTION(BlueprintPure, meta=(ToolTip="Cable list, each added cable including the first one"))
+	TArray<UCableComponent*> GetCableList() const;
+
+	UFUNCTION(BlueprintPure, meta=(ToolTip="Attached cables, each cable ending on a wrap point, the hook side one excluded"))
+	TArray<UCableComponent*> GetCableAttachedList() const;
 
+	UFUNCTION(BlueprintPure, meta=(ToolTip="Cable caps, one per wrap point"))
+	TArray<UStaticMeshComponent*> GetCableCapList() const;
+
+protected:
+	//Status
 	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category="Status|Cable|Point",
 		meta=(ToolTip="Default First Cable lenght"))
 	UCurveFloat* CableTensCurve = nullptr;
@@ -225,10 +337,34 @@ protected:
 	//Parameters
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Parameters|Cable",
 		meta=(ToolTip=
-			"Enable using of substep constant timer ticks instead of event tick, more stable tracing but issues like cable flickering"
+			"Apply pull at each physics step and wrap once per frame when physics advanced, instead of applying pull from event tick"
 		))
 	bool bCanUseSubstepTick = true;
 	
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Parameters|Cable",
+		meta=(ToolTip="Issue wrap and unwrap traces of the cable segments as one async batch after the wrap logic and use the results next frame"))
+	bool bAsyncCableTraces = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Parameters|Cable",
+		meta=(ToolTip="Wrap on the first contact of the surface swept by the cable segment since the last step (one overlap, then up to SweptWrapSamples + SweptWrapRefineIterations line traces per crossed component per step), instead of a line trace on the current segment only"))
+	bool bSweptCableWrap = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Parameters|Cable",
+		meta=(EditCondition="bSweptCableWrap", UIMin="1", ClampMin="1", UIMax="8", ClampMax="8", ToolTip="Segments tested along the sweep to find obstacles crossed between two steps"))
+	int32 SweptWrapSamples = 4;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Parameters|Cable",
+		meta=(EditCondition="bSweptCableWrap", UIMin="0", ClampMin="0", UIMax="16", ClampMax="16", ToolTip="Bisection steps refining the first contact along the sweep"))
+	int32 SweptWrapRefineIterations = 8;
+	
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Parameters|Cable|Point",
+		meta=(ToolTip="Compute geodesic intermediate points on a worker thread and use the last result meanwhile (sync when debugging)"))
+	bool bAsyncGeodesic = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Parameters|Cable|Point",
+		meta=(EditCondition="bAsyncGeodesic", UIMin="0", ClampMin="0", UIMax="10", ToolTip="Frames a wrap waits for its geodesic path before wrapping without intermediate points"))
+	int32 GeodesicMaxWaitFrames = 3;
+	
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Parameters|Cable|Point",
 		meta=(ToolTip="Static Mesh use for Caps, basically sphere"))
 	UStaticMesh* CapsMesh = nullptr;
@@ -241,6 +377,18 @@ protected:
 		meta=(UIMin="0", ClampMin="0", ToolTip="Static Mesh scale multiplicator use for Caps (CableWeight * this)"))
 	float CapsScaleMultiplicator = 0.0105;
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Parameters|Cable|Rope",
+		meta=(ToolTip=
+			"Simulate and render the whole rope in the single Rope component, wrap cables and caps are then only hidden wrap point views"
+		))
+	bool bUseSingleRope = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Parameters|Cable|Pool",
+		meta=(UIMin="0", ClampMin="0", ToolTip=
+			"Cables and caps created hidden at begin play, wrap and unwrap then activate and release them instead of creating and destroying components"
+		))
+	int32 CablePoolPrewarmCount = 8;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Parameters|Cable|Rope",
 		meta=(ToolTip=
 			"Use cable shared settings to the start cable, like width, length, basically all settings exlcuding the ones that cannot be changed at runtime, like segments, and etc."
@@ -303,19 +451,13 @@ protected:
 	UMaterialInterface* CableDebugMaterialInst = nullptr;
 
 	//Functions
-	UFUNCTION()
-	void SubstepTickLowLatency();
-
-	UFUNCTION()
-	void SubstepTickHighLatency();
-
 	UFUNCTION()
 	void CableWraping();
 
 	UFUNCTION()
 	void ConfigLastAndSetupNewCable(UCableComponent* lastCable, const FSCableWrapParams& currentTraceCableWarp,
 		UCableComponent*& newCable, const bool
-		bReverseLoc) const;
+		bReverseLoc);
 
 	UFUNCTION()
 	void ConfigCableToFirstCableSettings(UCableComponent* newCable) const;
@@ -323,6 +465,19 @@ protected:
 	UFUNCTION()
 	void SetupCableMaterial(UCableComponent* newCable) const;
 
+	// Single rope mode, the cable only tracks its wrap points
+	UFUNCTION()
+	void ConfigCableAsRopeView(UCableComponent* cable) const;
+
+	// Cable ends from its attachments, rope views don't tick so their particles and CableStart/CableEnd sockets are stale
+	static FVector GetCableStartLocation(const UCableComponent* cable);
+
+	static FVector GetCableEndLocation(const UCableComponent* cable);
+
+	// Single rope mode, push the wrap points of the cable chain to the rope
+	UFUNCTION()
+	void UpdateRope();
+
 	UFUNCTION()
 	void WrapCableAddByFirst();
 
@@ -342,34 +497,96 @@ protected:
 	void UnwrapCableByLast();
 
 	UFUNCTION()
-	bool TraceCableUnwrap(const UCableComponent* pastCable, const UCableComponent* currentCable, const bool& bReverseLoc, FHitResult& outHit) const;
+	bool TraceCableUnwrap(const UCableComponent* pastCable, const UCableComponent* currentCable, const bool& bReverseLoc, FHitResult& outHit);
 
 	UFUNCTION()
-	void TraceCableWrap(const UCableComponent* cable, bool bReverseLoc, FSCableWrapParams& outCableWarpParams) const;
+	void TraceCableWrap(const UCableComponent* cable, bool bReverseLoc, FSCableWrapParams& outCableWarpParams);
+
+	// Broadphase overlap on a thin box around the swept surface, then first contact on each blocking candidate (anchors only when the current segment hits them)
+	bool SweepCableWrap(const FVector& start, const FVector& end, const FPSCableSweepAnchors& anchors, FPSCableSweepState& sweepState, FHitResult& outHit) const;
+
+	// Coarse samples stop once clear past maxAlpha, bisection only runs on a blocked sample
+	bool FindFirstSweptContact(UPrimitiveComponent* component, const FPSCableSweepState& previous, const FVector& start, const FVector& end, const float maxAlpha, float& outAlpha, FHitResult& outHit) const;
+
+	void ComputeCableUnwrapTrace(const UCableComponent* pastCable, const UCableComponent* currentCable, const bool bReverseLoc, FVector& outStart, FVector& outEnd) const;
+
+	// Move hit location and trace end on the hit collision
+	void RefineCableUnwrapHit(FHitResult& outHit) const;
+
+	void InitCableTraceParams();
+
+	// Next frame results of the batch issued by RequestCableTraces
+	void ConsumeCableTraces();
+
+	void RequestCableTraces();
+
+	void ResetCableTraces();
+
+	FORCEINLINE bool HasCableTraceResult(const EPSCableTraceSlot slot) const { return _CableTraces[static_cast<int32>(slot)].bHasResult; }
+
+	// Copy the slot result and clear it, false without a result
+	bool ConsumeCableTraceResult(const EPSCableTraceSlot slot, FHitResult& outHit);
 
 	UFUNCTION()
 	static void UpdateCableWrapExtremityLoc(const UCableComponent* cable, bool bReverseLoc, FSCableWrapParams& outCableWarpParams);
 
 	UFUNCTION()
-	void AddSphereCaps(const FSCableWrapParams& currentTraceParams, const bool bIsAddByFirst);
+	UStaticMeshComponent* AddSphereCaps(const FSCableWrapParams& currentTraceParams);
+
+	// Wrap chain is the only store, blueprint views are built from it on call
+	void PushWrapPoint(const FPSCableWrapPoint& wrapPoint, const bool bFirst);
+
+	void PopWrapPoint(const bool bFirst);
+
+	void ResetWrapChain();
+
+	// Traces were requested and segments swept for the old chain, only at the changed end unless both ends share its wrap points
+	void ResetWrapChainQueries(const bool bFirst, const bool bBothEnds);
 
 	//Check if this location is not existing already in "cable points locations", error tolerance to determine how close another wrap point can be added
 	UFUNCTION()
 	bool CheckPointLocation(const FVector& targetLoc, const float& errorTolerance);
 
+	// Wrap points along the mesh surface between the chain end and the new hit on the same mesh, false while the wrap waits for its async path
 	UFUNCTION()
-	void GenerateIntermediatePoint(const FVector& lastPointLoc, const FVector& newPointLoc, FSCableWrapParams& currentTraceCableWrap, bool bReverseLoc);
+	bool GenerateIntermediatePoint(const FVector& lastPointLoc, FSCableWrapParams& currentTraceCableWrap, bool bReverseLoc);
 	
 	UFUNCTION()
 	void AdaptCableTense(const float alphaTense);
 
-private:
+	//Pool
+	UFUNCTION()
+	void PrewarmCablePool();
 
-	UPROPERTY(Transient)
-	FTimerHandle _LowSubstepTickHandler;
+	// Registered hidden and without tick, ready to be acquired
+	UFUNCTION()
+	UCableComponent* CreatePooledCable();
 
-	UPROPERTY(Transient)
-	FTimerHandle _HighSubstepTickHandler;
+	UFUNCTION()
+	UStaticMeshComponent* CreatePooledCap();
+
+	UFUNCTION()
+	UCableComponent* AcquireCable();
+
+	UFUNCTION()
+	void ReleaseCable(UCableComponent* cable);
+
+	UFUNCTION()
+	UStaticMeshComponent* AcquireCap();
+
+	UFUNCTION()
+	void ReleaseCap(UStaticMeshComponent* cap);
+
+	// Acquired cable particles keep their last use, lay them between the new wrap points once ends are set (simulated cables only)
+	UFUNCTION()
+	void ResetPooledCableParticles(UCableComponent* cable);
+
+	void UpdateCablePoolStats() const;
+
+	// Live cables, segments and caps for stat Hook and CSV
+	void UpdateHookStats() const;
+
+private:
 
 	UPROPERTY(Transient)
 	float _FirstCableDefaultLenght;
@@ -383,6 +600,10 @@ private:
 	UPROPERTY(Transient)
 	float _AlphaTense;
 
+	// Reused each tick by AdaptCableTense
+	UPROPERTY(Transient)
+	TArray<float> _SpanLengthRatios;
+
 	UPROPERTY(Transient)
 	float _AlphaPull;
 
@@ -394,6 +615,42 @@ private:
 	
 	UPROPERTY(Transient)
 	bool _bWrappingByLast;
+
+	// Single geodesic request in flight, a new one waits until it is done
+	TFuture<FPSGeodesicPathResult> _PendingGeodesicPath;
+
+	FPSGeodesicWrapKey _PendingGeodesicKey;
+
+	uint64 _PendingGeodesicFrame = 0;
+
+	TDeque<FPSCableWrapPoint> _WrapChain;
+
+	TStaticArray<FPSCableTrace, static_cast<int32>(EPSCableTraceSlot::Count)> _CableTraces;
+
+	// Wrap by last then wrap by first
+	TStaticArray<FPSCableSweepState, 2> _CableSweepStates;
+
+	FCollisionQueryParams _CableWrapTraceParams;
+
+	FCollisionQueryParams _CableUnwrapTraceParams;
+
+	UPROPERTY(Transient)
+	TArray<UCableComponent*> _FreeCablePool;
+
+	UPROPERTY(Transient)
+	TArray<UStaticMeshComponent*> _FreeCapPool;
+
+	UPROPERTY(Transient)
+	int32 _CablePoolHits = 0;
+
+	UPROPERTY(Transient)
+	int32 _CablePoolMisses = 0;
+
+	UPROPERTY(Transient)
+	int32 _CapPoolHits = 0;
+
+	UPROPERTY(Transient)
+	int32 _CapPoolMisses = 0;
 	
 #pragma endregion Cable
 
@@ -573,6 +830,16 @@ protected:
 
 	UFUNCTION()
 	void PowerCablePull();
+
+	// Game thread, pull is applied by the next physics steps until a new command is published
+	void PublishPullCommand(const FPSHookPullCommand& command);
+
+	// Physics step, only touches the attached body proxy
+	void ApplyPullCommand(const float deltaTime);
+
+	// Body destroyed (detach, slice, destroy): physics steps must not keep its handle
+	UFUNCTION()
+	void OnAttachedMeshPhysicsStateChanged(UPrimitiveComponent* changedComponent, EComponentPhysicsStateChange stateChange);
 	
 	UFUNCTION()
 	void OnPushTimerEndEventReceived(const FTimerHandle selfHandler, const FVector& currentPushDir, const float pushAccel);
@@ -608,6 +875,16 @@ private:
 
 	UPROPERTY(Transient)
 	bool bHasTriggerBreakByFall;
+
+	FPSHookPullCommand _PullCommand;
+
+	FCriticalSection _PullCommandLock;
+
+	// Physics steps simulated since the last game frame
+	std::atomic<int32> _PendingPhysicsSteps = 0;
+
+	// Only used by physics steps
+	FRandomStream _PhysicsRandomStream;
 	
 	//------------------
 #pragma endregion Pull
@@ -639,7 +916,13 @@ public:
 
 	FORCEINLINE bool IsPlayerSwinging() const { return _bPlayerIsSwinging; }
 
+	FORCEINLINE bool IsAnalyticSwing() const { return SwingMode == ESwingMode::ANALYTIC; }
+
 protected:	
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Parameters|Hook|Swing",
+	meta=(ToolTip="Physic constraint rig or pendulum integrated in the player movement step"))
+	ESwingMode SwingMode = ESwingMode::PHYSIC_CONSTRAINT;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Parameters|Hook|Swing",
 	meta=(ToolTip="Swing force multiplicator"))
 	float SwingCustomAirControlMultiplier = 4.0f;
@@ -687,6 +970,14 @@ private:
 	UPROPERTY(Transient)
 	bool _bUpdateMasterContraintByTime;
 
+	void OnAnalyticSwingPhysic(const float deltaTime);
+
+	// Rope point the player swing around: last wrap point or attached object
+	FVector GetSwingPivotLocation() const;
+
+	// Length left between pivot and player once wrapped spans are removed
+	float GetSwingFreeRopeLength() const;
+
 #pragma endregion Swing
 
 #pragma region Destruction
@@ -326,7 +326,7 @@ void UPS_ParkourComponent::StopWallRun()
 	//Cooldown
 	FTimerDelegate dashReset_TimerDelegate;
 	dashReset_TimerDelegate.BindUObject(this, &UPS_ParkourComponent::ResetDash);
-	UPSFl::SetDilatedRealTimeTimer(GetWorld(), _WallRunResetTimerHandle, dashReset_TimerDelegate, WallRunCooldownDuration, false);
+	UPSFl::SetPSTimer(GetWorld(), _WallRunResetTimerHandle, dashReset_TimerDelegate, WallRunCooldownDuration, false, EPSTimerClock::ACTOR_TIME, -1.0f, 1.0f, GetOwner());
 
 	//Reset Variables
 	_VelocityWeight = 1.0f;
@@ -937,7 +937,7 @@ void UPS_ParkourComponent::OnDash()
 	//Reset
 	FTimerDelegate dashReset_TimerDelegate;
 	dashReset_TimerDelegate.BindUObject(this, &UPS_ParkourComponent::ResetDash);
-	UPSFl::SetDilatedRealTimeTimer(GetWorld(), _DashResetTimerHandle, dashReset_TimerDelegate, DashDuration, false);
+	UPSFl::SetPSTimer(GetWorld(), _DashResetTimerHandle, dashReset_TimerDelegate, DashDuration, false, EPSTimerClock::ACTOR_TIME, -1.0f, 1.0f, GetOwner());
 	
 	if(bDebugDash) 
 	{
@@ -8,6 +8,7 @@
 #include "ProjectSlice/Character/PC/PS_PlayerController.h"
 #include "ProjectSlice/Data/PS_Delegates.h"
 #include "ProjectSlice/Data/PS_GlobalType.h"
+#include "ProjectSlice/System/PS_TimerSubsystem.h"
 #include "PS_ParkourComponent.generated.h"
 
 class AProjectSliceCharacter;
@@ -355,7 +356,7 @@ private:
 	FVector _WallRunEnterVelocity;
 
 	UPROPERTY(Transient)
-	FTimerHandle _WallRunResetTimerHandle;
+	FPSTimerHandle _WallRunResetTimerHandle;
 
 #pragma endregion WallRun
 
@@ -560,7 +561,7 @@ protected:
 
 private:
 	UPROPERTY(Transient)
-	FTimerHandle _DashResetTimerHandle;
+	FPSTimerHandle _DashResetTimerHandle;
 
 	UPROPERTY(Transient)
 	bool _bIsDashing;
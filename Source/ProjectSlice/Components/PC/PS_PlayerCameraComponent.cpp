@@ -39,6 +39,11 @@ void UPS_PlayerCameraComponent::BeginPlay()
 {
 	Super::BeginPlay();
 
+	//Bake interpolation curves, FOV curve is rebaked by each interp setup
+	_CurveLUTs.Init(static_cast<int32>(EPSCameraCurveSlot::Count));
+	_CurveLUTs.Bake(static_cast<int32>(EPSCameraCurveSlot::FOV), FOVIntertpCurve);
+	_CurveLUTs.Bake(static_cast<int32>(EPSCameraCurveSlot::Tilt), CameraTiltCurve);
+
 	//Init default Variable
 	_PlayerCharacter = Cast<AProjectSliceCharacter>(GetOwner());
 	if(!IsValid(_PlayerCharacter)) return;
@@ -75,6 +80,8 @@ void UPS_PlayerCameraComponent::EndPlay(const EEndPlayReason::Type EndPlayReason
 		_PlayerCharacter->GetSlowmoComponent()->OnStopSlowmoEvent.RemoveDynamic(this, &UPS_PlayerCameraComponent::OnStopSlowmoEventReceiver);
 	}
 
+	_CurveLUTs.Reset();
+
 	Super::EndPlay(EndPlayReason);
 
 }
@@ -93,32 +100,22 @@ void UPS_PlayerCameraComponent::StartCustomTick()
 	
 	if (bDebug) UE_LOG(LogTemp, Log, TEXT("%S"), __FUNCTION__);
 
-	UGameInstance* GameInstance = GetWorld()->GetGameInstance();
-	if (!GameInstance)
+	UGameInstance* gameInstance = GetWorld()->GetGameInstance();
+	UPS_TimerSubsystem* timerSubsystem = IsValid(gameInstance) ? gameInstance->GetSubsystem<UPS_TimerSubsystem>() : nullptr;
+	if (!IsValid(timerSubsystem))
 	{
-		UE_LOG(LogTemp, Error, TEXT("StartCustomTick: GameInstance NOT FOUND!"));
+		if (bDebug) UE_LOG(LogTemp, Log, TEXT("%S :: TimerSubsystem not found"), __FUNCTION__);
 		return;
 	}
 
-	UPS_TimerSubsystem* TimerSubsystem = GameInstance->GetSubsystem<UPS_TimerSubsystem>();
-	if (!TimerSubsystem)
-	{
-		UE_LOG(LogTemp, Error, TEXT("StartCustomTick: TimerSubsystem NOT FOUND!"));
-		return;
-	}
-    
-	UE_LOG(LogTemp, Error, TEXT("StartCustomTick: TimerSubsystem FOUND! Active timers: %d"), 
-		TimerSubsystem->Timers.Num());
-    
-	if (bDebug) UE_LOG(LogTemp, Log, TEXT("%S"), __FUNCTION__);
+	if (bDebug) UE_LOG(LogTemp, Log, TEXT("%S :: active timers %i"), __FUNCTION__, timerSubsystem->GetActiveTimerCount());
 	
 	_LastTickTime = GetWorld()->GetRealTimeSeconds();
 	FTimerDelegate delegate;
 	delegate.BindUObject(this, &UPS_PlayerCameraComponent::CustomTick);
-	UPSFl::SetDilatedRealTimeTimer(GetWorld(), _CustomTickTimerHandler, delegate, 0.025f, true, -1.0f, 1.0f);
+	UPSFl::SetPSTimer(GetWorld(), _CustomTickTimerHandler, delegate, 0.025f, true, EPSTimerClock::ACTOR_TIME, -1.0f, 1.0f, GetOwner());
 	
-	UE_LOG(LogTemp, Error, TEXT("StartCustomTick: Timer created! Handle valid = %d"), 
-		_CustomTickTimerHandler.IsValid());
+	if (bDebug) UE_LOG(LogTemp, Log, TEXT("%S :: timer handle valid %i"), __FUNCTION__, _CustomTickTimerHandler.IsValid());
 }
 
 void UPS_PlayerCameraComponent::CustomTick()
@@ -155,6 +152,7 @@ void UPS_PlayerCameraComponent::SetupFOVInterp(const float targetFOV, const floa
 	_CurrentFOVInterpTime = 0.0f;
 	FOVIntertpDuration = duration;
 	FOVIntertpCurve = interCurve;
+	_CurveLUTs.Bake(static_cast<int32>(EPSCameraCurveSlot::FOV), FOVIntertpCurve);
 	
 	bFieldOfViewInterpChange = true;
 
@@ -170,12 +168,7 @@ void UPS_PlayerCameraComponent::FieldOfViewTick(const float deltaTime)
 	const float alpha = UKismetMathLibrary::MapRangeClamped(_CurrentFOVInterpTime, _StartFOVInterpTimestamp,
 		_StartFOVInterpTimestamp + FOVIntertpDuration, 0.0f, 1.0f);
 	
-	float curveAlpha = alpha;
-
-	if (IsValid(FOVIntertpCurve))
-	{
-		curveAlpha = FOVIntertpCurve->GetFloatValue(alpha);
-	}
+	const float curveAlpha = EvaluateCurve(EPSCameraCurveSlot::FOV, alpha);
 	SetFieldOfView(FMath::Lerp(StartFOV, TargetFOV, curveAlpha));
 
 	if (alpha >= 1.0f)
@@ -430,9 +423,7 @@ void UPS_PlayerCameraComponent::CameraRollTilt(const float& deltaTime)
 	const float alphaTilt = _CurrentCameraTiltRollParams.bUseDynTiltUpdating && !_bIsResetingCameraTilt? _AlphaTiltWeight : UKismetMathLibrary::MapRangeClamped(GetWorld()->GetRealTimeSeconds(), _StartCameraTiltTimestamp, targetTiltTime, 0,1);                                                                                                                
 	
 	//Interp                                                                                                                                                                                                                                    
-	float curveTiltAlpha = alphaTilt;                                                                                                                                                                                                  
-	if(IsValid(CameraTiltCurve))                                                                                                                                                                                                                
-		curveTiltAlpha = CameraTiltCurve->GetFloatValue(alphaTilt);                                                                                                                                                                             
+	const float curveTiltAlpha = EvaluateCurve(EPSCameraCurveSlot::Tilt, alphaTilt);
 	
 	//New Tilt Rot
 	FRotator newRot =  FMath::Lerp(_StartCameraRot,newRotTarget, curveTiltAlpha);
@@ -6,7 +6,9 @@
 #include "Camera/CameraComponent.h"
 #include "ProjectSlice/Data/PS_Delegates.h"
 #include "ProjectSlice/Data/PS_GlobalType.h"
+#include "ProjectSlice/System/PS_TimerSubsystem.h"
 #include "ProjectSlice/FunctionLibrary/PSFL_CameraShake.h"
+#include "ProjectSlice/FunctionLibrary/PSFL_CurveLUT.h"
 #include "PS_PlayerCameraComponent.generated.h"
 
 class AProjectSlicePlayerController;
@@ -15,6 +17,14 @@ class AProjectSliceCharacter;
  * 
  */
 
+// Interpolation curves baked in _CurveLUTs
+enum class EPSCameraCurveSlot : uint8
+{
+	FOV,
+	Tilt,
+	Count
+};
+
 UENUM()
 enum class ETiltType : uint8
 {
@@ -119,7 +129,11 @@ private:
 	float _LastTickTime;
 
 	UPROPERTY(Transient)
-	FTimerHandle _CustomTickTimerHandler;
+	FPSTimerHandle _CustomTickTimerHandler;
+
+	FPSCurveLUTStore _CurveLUTs;
+
+	FORCEINLINE float EvaluateCurve(const EPSCameraCurveSlot slot, const float alpha) const { return _CurveLUTs.Evaluate(static_cast<int32>(slot), alpha); }
 
 #pragma region FOV
 	//------------------
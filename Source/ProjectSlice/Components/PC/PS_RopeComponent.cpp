@@ -0,0 +1,509 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "PS_RopeComponent.h"
+
+#include "DrawDebugHelpers.h"
+#include "Camera/PlayerCameraManager.h"
+#include "GameFramework/PlayerController.h"
+#include "Kismet/KismetMathLibrary.h"
+#include "ProjectSlice/Data/PS_Constants.h"
+
+FVector FPSRopeAnchor::GetLocation() const
+{
+	return Component.IsValid() ? Component->GetSocketTransform(SocketName).TransformPosition(LocalOffset) : FVector::ZeroVector;
+}
+
+UPS_RopeComponent::UPS_RopeComponent(const FObjectInitializer& objectInitializer) : Super(objectInitializer)
+{
+	PrimaryComponentTick.bCanEverTick = true;
+
+	//Anchors follow simulated objects
+	PrimaryComponentTick.TickGroup = TG_PostPhysics;
+
+	//Particles are in world space
+	SetUsingAbsoluteLocation(true);
+	SetUsingAbsoluteRotation(true);
+	SetUsingAbsoluteScale(true);
+
+	UPrimitiveComponent::SetCollisionProfileName(Profile_NoCollision, false);
+	SetGenerateOverlapEvents(false);
+	bUseAsyncCooking = true;
+}
+
+void UPS_RopeComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	if(!IsValid(GetWorld())) return;
+
+	//No rope, clear render
+	if(_Anchors.Num() < 2 || _Particles.IsEmpty())
+	{
+		if(_MeshParticleCount > 0)
+		{
+			ClearAllMeshSections();
+			_MeshParticleCount = 0;
+		}
+		return;
+	}
+
+	UpdateView();
+	UpdateSpanLODs();
+	UpdateAnchorParticles();
+
+	//Fixed substeps, remainder carried to next frame
+	const FVector gravity = FVector(0.0f, 0.0f, GetWorld()->GetGravityZ() * GravityScale);
+	_TimeRemainder = FMath::Min(_TimeRemainder + DeltaTime, SubstepTime * 4.0f);
+	bool bHasStepped = false;
+	while(_TimeRemainder >= SubstepTime)
+	{
+		VerletIntegrate(SubstepTime, gravity);
+		SolveConstraints();
+		_TimeRemainder -= SubstepTime;
+		bHasStepped = true;
+	}
+
+	//Whole rope asleep, last mesh still valid
+	if(UpdateSpanStates(DeltaTime, bHasStepped) || _MeshParticleCount != _Particles.Num()) BuildMesh();
+
+	if(bDebug)
+	{
+		for (const FPSRopeAnchor& anchor : _Anchors)
+		{
+			DrawDebugPoint(GetWorld(), anchor.GetLocation(), 10.0f, FColor::Yellow, false, -1.0f);
+		}
+
+		for (const FPSRopeSpan& span : _Spans)
+		{
+			const FColor color = span.bTaut ? FColor::Blue : span.bAsleep ? FColor::Black : FColor::MakeRedToGreenColorFromScalar(1.0f - static_cast<float>(span.LODLevel) / (LODLevelCount - 1));
+			DrawDebugLine(GetWorld(), _Particles[span.FirstParticle].Position, _Particles[span.FirstParticle + span.Segments].Position, color, false, -1.0f, 0, 0.5f);
+		}
+	}
+}
+
+#pragma region Anchor
+//------------------
+
+void UPS_RopeComponent::SetAnchors(const TArray<FPSRopeAnchor>& anchors)
+{
+	if(anchors == _Anchors) return;
+
+	const TArray<FPSRopeAnchor> oldAnchors = MoveTemp(_Anchors);
+	const TArray<FPSRopeSpan> oldSpans = MoveTemp(_Spans);
+	const TArray<FPSRopeParticle> oldParticles = MoveTemp(_Particles);
+
+	_Anchors = anchors;
+	UpdateView();
+	RebuildParticles(oldAnchors, oldSpans, oldParticles);
+
+	if(bDebug) UE_LOG(LogTemp, Log, TEXT("%S :: anchors %i, particles %i"), __FUNCTION__, _Anchors.Num(), _Particles.Num());
+}
+
+void UPS_RopeComponent::SetSpanLengthRatios(const TArray<float>& ratios)
+{
+	_SpanLengthRatios = ratios;
+}
+
+void UPS_RopeComponent::ClearAnchors()
+{
+	SetAnchors(TArray<FPSRopeAnchor>());
+}
+
+void UPS_RopeComponent::RebuildParticles(const TArray<FPSRopeAnchor>& oldAnchors, const TArray<FPSRopeSpan>& oldSpans, const TArray<FPSRopeParticle>& oldParticles)
+{
+	_Particles.Reset();
+	_Spans.Reset();
+	_TimeRemainder = 0.0f;
+
+	if(_Anchors.Num() < 2) return;
+
+	//Old buffer only reusable if it matches the old anchors layout
+	const bool bCanReuse = oldSpans.Num() == FMath::Max(oldAnchors.Num() - 1, 0)
+		&& !oldSpans.IsEmpty()
+		&& oldParticles.Num() == oldSpans.Last().FirstParticle + oldSpans.Last().Segments + 1;
+
+	//Layout from each span LOD
+	TArray<int32, TInlineAllocator<16>> oldSpanIndices;
+	oldSpanIndices.Init(INDEX_NONE, GetSpanCount());
+	_Spans.SetNum(GetSpanCount());
+
+	int32 particleCount = 1;
+	for (int32 spanIndex = 0; spanIndex < GetSpanCount(); spanIndex++)
+	{
+		const FPSRopeAnchor& startAnchor = _Anchors[spanIndex];
+		const FPSRopeAnchor& endAnchor = _Anchors[spanIndex + 1];
+
+		//Span still between the same wrap points, keep its simulated shape and LOD
+		if(bCanReuse)
+		{
+			for (int32 i = 0; i < oldSpans.Num(); i++)
+			{
+				if(oldAnchors[i] == startAnchor && oldAnchors[i + 1] == endAnchor)
+				{
+					oldSpanIndices[spanIndex] = i;
+					break;
+				}
+			}
+		}
+
+		FPSRopeSpan& span = _Spans[spanIndex];
+		const int32 oldSpanIndex = oldSpanIndices[spanIndex];
+		span.LODLevel = oldSpanIndex != INDEX_NONE ? oldSpans[oldSpanIndex].LODLevel : ComputeSpanLODLevel(startAnchor.GetLocation(), endAnchor.GetLocation(), INDEX_NONE);
+		span.Segments = GetLODSegments(span.LODLevel);
+		span.FirstParticle = particleCount - 1;
+		particleCount += span.Segments;
+	}
+
+	_Particles.SetNum(particleCount);
+	for (int32 spanIndex = 0; spanIndex < GetSpanCount(); spanIndex++)
+	{
+		const FPSRopeSpan& span = _Spans[spanIndex];
+		const int32 oldSpanIndex = oldSpanIndices[spanIndex];
+
+		const FVector startLoc = _Anchors[spanIndex].GetLocation();
+		const FVector endLoc = _Anchors[spanIndex + 1].GetLocation();
+		for (int32 segmentIndex = 0; segmentIndex <= span.Segments; segmentIndex++)
+		{
+			FPSRopeParticle& particle = _Particles[span.FirstParticle + segmentIndex];
+			const float alpha = static_cast<float>(segmentIndex) / span.Segments;
+
+			//Resample old span shape at the new segment count
+			if(oldSpanIndex != INDEX_NONE)
+			{
+				const FPSRopeSpan& oldSpan = oldSpans[oldSpanIndex];
+				const float oldSegment = alpha * oldSpan.Segments;
+				const int32 oldIndex = FMath::Min(FMath::FloorToInt32(oldSegment), oldSpan.Segments - 1);
+				const float oldAlpha = oldSegment - oldIndex;
+
+				const FPSRopeParticle& oldA = oldParticles[oldSpan.FirstParticle + oldIndex];
+				const FPSRopeParticle& oldB = oldParticles[oldSpan.FirstParticle + oldIndex + 1];
+				particle.Position = FMath::Lerp(oldA.Position, oldB.Position, oldAlpha);
+				particle.OldPosition = FMath::Lerp(oldA.OldPosition, oldB.OldPosition, oldAlpha);
+			}
+			else
+			{
+				particle.Position = particle.OldPosition = FMath::Lerp(startLoc, endLoc, alpha);
+			}
+			particle.bFree = segmentIndex != 0 && segmentIndex != span.Segments;
+		}
+	}
+}
+
+//------------------
+#pragma endregion Anchor
+
+#pragma region Simulation
+//------------------
+
+void UPS_RopeComponent::UpdateAnchorParticles()
+{
+	FVector lastAnchorLoc = FVector::ZeroVector;
+	for (int32 anchorIndex = 0; anchorIndex < _Anchors.Num(); anchorIndex++)
+	{
+		const FVector anchorLoc = _Anchors[anchorIndex].GetLocation();
+
+		FPSRopeParticle& particle = _Particles[GetAnchorParticleIndex(anchorIndex)];
+		particle.Position = particle.OldPosition = anchorLoc;
+
+		//Rest length from the current distance between wrap points, like the old per cable length
+		if(anchorIndex > 0)
+		{
+			const int32 spanIndex = anchorIndex - 1;
+			FPSRopeSpan& span = _Spans[spanIndex];
+			const float ratio = GetSpanLengthRatio(spanIndex);
+			span.RestLength = FVector::Distance(lastAnchorLoc, anchorLoc) * ratio / span.Segments;
+
+			//Stretched span, nothing to simulate
+			const bool bTaut = bEnableLOD && _TenseAlpha >= TautTenseThreshold && ratio <= 1.0f;
+			if(bTaut != span.bTaut)
+			{
+				WakeSpan(span);
+				span.bTaut = bTaut;
+			}
+
+			//Anchor or length moved under a sleeping span
+			if(span.bAsleep
+				&& (FVector::DistSquared(span.SleepStartLoc, lastAnchorLoc) > FMath::Square(WakeAnchorDistance)
+					|| FVector::DistSquared(span.SleepEndLoc, anchorLoc) > FMath::Square(WakeAnchorDistance)
+					|| !FMath::IsNearlyEqual(span.SleepRatio, ratio, 0.01f)))
+			{
+				WakeSpan(span);
+			}
+		}
+		lastAnchorLoc = anchorLoc;
+	}
+}
+
+void UPS_RopeComponent::VerletIntegrate(const float substepTime, const FVector& gravity)
+{
+	const FVector gravityStep = gravity * FMath::Square(substepTime);
+	const float velocityScale = 1.0f - Damping;
+
+	for (const FPSRopeSpan& span : _Spans)
+	{
+		if(!span.IsSimulated()) continue;
+
+		for (int32 i = span.FirstParticle + 1; i < span.FirstParticle + span.Segments; i++)
+		{
+			FPSRopeParticle& particle = _Particles[i];
+			if(!particle.bFree) continue;
+
+			const FVector velocity = (particle.Position - particle.OldPosition) * velocityScale;
+			particle.OldPosition = particle.Position;
+			particle.Position += velocity + gravityStep;
+		}
+	}
+}
+
+void UPS_RopeComponent::SolveConstraints()
+{
+	//Pinned anchors split the spans, each span is solved alone with its LOD iterations
+	for (const FPSRopeSpan& span : _Spans)
+	{
+		if(!span.IsSimulated()) continue;
+
+		const int32 iterations = GetLODSolverIterations(span.LODLevel);
+		for (int32 iteration = 0; iteration < iterations; iteration++)
+		{
+			for (int32 i = span.FirstParticle; i < span.FirstParticle + span.Segments; i++)
+			{
+				FPSRopeParticle& particleA = _Particles[i];
+				FPSRopeParticle& particleB = _Particles[i + 1];
+
+				const FVector delta = particleB.Position - particleA.Position;
+				const float currentLength = delta.Size();
+				if(currentLength <= UE_SMALL_NUMBER) continue;
+
+				const FVector correction = delta * ((currentLength - span.RestLength) / currentLength);
+				if(particleA.bFree && particleB.bFree)
+				{
+					particleA.Position += correction * 0.5f;
+					particleB.Position -= correction * 0.5f;
+				}
+				else if(particleA.bFree)
+				{
+					particleA.Position += correction;
+				}
+				else if(particleB.bFree)
+				{
+					particleB.Position -= correction;
+				}
+			}
+		}
+	}
+}
+
+//------------------
+#pragma endregion Simulation
+
+#pragma region LOD
+//------------------
+
+void UPS_RopeComponent::SetLODInputs(const float tenseAlpha, const float viewerSpeed)
+{
+	_TenseAlpha = tenseAlpha;
+	_ViewerSpeed = viewerSpeed;
+}
+
+void UPS_RopeComponent::UpdateView()
+{
+	const APlayerController* playerController = IsValid(GetWorld()) ? GetWorld()->GetFirstPlayerController() : nullptr;
+	if(!IsValid(playerController) || !IsValid(playerController->PlayerCameraManager)) return;
+
+	_ViewLoc = playerController->PlayerCameraManager->GetCameraLocation();
+	_ViewTanHalfFOV = FMath::Max(FMath::Tan(FMath::DegreesToRadians(playerController->PlayerCameraManager->GetFOVAngle() * 0.5f)), UE_KINDA_SMALL_NUMBER);
+}
+
+int32 UPS_RopeComponent::ComputeSpanLODLevel(const FVector& startLoc, const FVector& endLoc, const int32 currentLevel) const
+{
+	if(!bEnableLOD) return 0;
+
+	//Span bounds projected on screen
+	const FVector center = (startLoc + endLoc) * 0.5f;
+	const float viewDist = FMath::Max(FVector::Distance(_ViewLoc, center), 1.0f);
+	const float screenSize = FVector::Distance(startLoc, endLoc) * 0.5f / (viewDist * _ViewTanHalfFOV);
+
+	const float screenAlpha = UKismetMathLibrary::MapRangeClamped(screenSize, FullLODScreenSize, LowLODScreenSize, 0.0f, 1.0f);
+	const float speedAlpha = UKismetMathLibrary::MapRangeClamped(_ViewerSpeed, LowLODViewerSpeed * 0.5f, LowLODViewerSpeed, 0.0f, 1.0f);
+	const float tenseAlpha = UKismetMathLibrary::MapRangeClamped(_TenseAlpha, 0.5f, TautTenseThreshold, 0.0f, 1.0f);
+
+	const float targetLevel = FMath::Max3(screenAlpha, speedAlpha, tenseAlpha) * (LODLevelCount - 1);
+	if(currentLevel != INDEX_NONE && FMath::Abs(targetLevel - currentLevel) <= 0.5f + LODHysteresis) return currentLevel;
+
+	return FMath::Clamp(FMath::RoundToInt32(targetLevel), 0, LODLevelCount - 1);
+}
+
+int32 UPS_RopeComponent::GetLODSegments(const int32 lodLevel) const
+{
+	const float alpha = static_cast<float>(lodLevel) / (LODLevelCount - 1);
+	return FMath::Max(FMath::RoundToInt32(FMath::Lerp(static_cast<float>(SegmentsPerSpan), static_cast<float>(FMath::Min(MinSegmentsPerSpan, SegmentsPerSpan)), alpha)), 1);
+}
+
+int32 UPS_RopeComponent::GetLODSolverIterations(const int32 lodLevel) const
+{
+	const float alpha = static_cast<float>(lodLevel) / (LODLevelCount - 1);
+	return FMath::Max(FMath::RoundToInt32(FMath::Lerp(static_cast<float>(SolverIterations), static_cast<float>(FMath::Min(MinSolverIterations, SolverIterations)), alpha)), 1);
+}
+
+void UPS_RopeComponent::UpdateSpanLODs()
+{
+	bool bHasChanged = false;
+	for (FPSRopeSpan& span : _Spans)
+	{
+		//Anchor particles hold last frame anchor locations
+		const int32 lodLevel = ComputeSpanLODLevel(_Particles[span.FirstParticle].Position, _Particles[span.FirstParticle + span.Segments].Position, span.LODLevel);
+		if(lodLevel == span.LODLevel) continue;
+
+		span.LODLevel = lodLevel;
+		bHasChanged |= GetLODSegments(lodLevel) != span.Segments;
+	}
+
+	if(!bHasChanged) return;
+
+	//Same anchors, only the segment count of the changed spans differs
+	const TArray<FPSRopeSpan> oldSpans = MoveTemp(_Spans);
+	const TArray<FPSRopeParticle> oldParticles = MoveTemp(_Particles);
+	RebuildParticles(_Anchors, oldSpans, oldParticles);
+
+	if(bDebug) UE_LOG(LogTemp, Log, TEXT("%S :: particles %i"), __FUNCTION__, _Particles.Num());
+}
+
+bool UPS_RopeComponent::UpdateSpanStates(const float deltaTime, const bool bHasStepped)
+{
+	bool bMustBuildMesh = false;
+	for (int32 spanIndex = 0; spanIndex < _Spans.Num(); spanIndex++)
+	{
+		FPSRopeSpan& span = _Spans[spanIndex];
+		FPSRopeParticle* particles = &_Particles[span.FirstParticle];
+
+		//Straight line between anchors
+		if(span.bTaut)
+		{
+			for (int32 i = 1; i < span.Segments; i++)
+			{
+				particles[i].Position = particles[i].OldPosition = FMath::Lerp(particles[0].Position, particles[span.Segments].Position, static_cast<float>(i) / span.Segments);
+			}
+			bMustBuildMesh = true;
+			continue;
+		}
+
+		if(span.bAsleep) continue;
+		bMustBuildMesh = true;
+
+		if(!bEnableLOD || !bHasStepped) continue;
+
+		//Fastest particle of the span on last substep
+		float maxMoveSquared = 0.0f;
+		for (int32 i = 1; i < span.Segments; i++)
+		{
+			maxMoveSquared = FMath::Max(maxMoveSquared, FVector::DistSquared(particles[i].Position, particles[i].OldPosition));
+		}
+
+		span.RestTime = maxMoveSquared <= FMath::Square(SleepSpeedThreshold * SubstepTime) ? span.RestTime + deltaTime : 0.0f;
+		if(span.RestTime < SleepDelay) continue;
+
+		span.bAsleep = true;
+		span.SleepStartLoc = particles[0].Position;
+		span.SleepEndLoc = particles[span.Segments].Position;
+		span.SleepRatio = GetSpanLengthRatio(spanIndex);
+		for (int32 i = 1; i < span.Segments; i++)
+		{
+			particles[i].OldPosition = particles[i].Position;
+		}
+
+		if(bDebug) UE_LOG(LogTemp, Log, TEXT("%S :: span %i asleep"), __FUNCTION__, spanIndex);
+	}
+
+	return bMustBuildMesh;
+}
+
+void UPS_RopeComponent::WakeSpan(FPSRopeSpan& span)
+{
+	span.bAsleep = false;
+	span.RestTime = 0.0f;
+}
+
+//------------------
+#pragma endregion LOD
+
+#pragma region Render
+//------------------
+
+void UPS_RopeComponent::BuildMesh()
+{
+	const int32 particleCount = _Particles.Num();
+	const int32 ringVertexCount = NumSides + 1;
+	const bool bTopologyChanged = _MeshParticleCount != particleCount || _Vertices.Num() != particleCount * ringVertexCount;
+
+	_Vertices.SetNumUninitialized(particleCount * ringVertexCount);
+	_Normals.SetNumUninitialized(particleCount * ringVertexCount);
+	_UV0.SetNumUninitialized(particleCount * ringVertexCount);
+	_Tangents.SetNumUninitialized(particleCount * ringVertexCount);
+
+	//Same vertex frame as the cable component
+	const FVector worldUp(1.0f, 0.0f, 0.0f);
+	const float radius = RopeWidth * 0.5f;
+	for (int32 spanIndex = 0; spanIndex < _Spans.Num(); spanIndex++)
+	{
+		const FPSRopeSpan& span = _Spans[spanIndex];
+
+		//Shared anchor particle is written by the next span
+		const int32 lastSegment = spanIndex == _Spans.Num() - 1 ? span.Segments : span.Segments - 1;
+		for (int32 segmentIndex = 0; segmentIndex <= lastSegment; segmentIndex++)
+		{
+			const int32 i = span.FirstParticle + segmentIndex;
+			const FVector& prevPos = _Particles[FMath::Max(i - 1, 0)].Position;
+			const FVector& nextPos = _Particles[FMath::Min(i + 1, particleCount - 1)].Position;
+			const FVector forwardDir = (nextPos - prevPos).GetSafeNormal(UE_SMALL_NUMBER, FVector::ForwardVector);
+
+			const FQuat rotQuat = FQuat::FindBetweenNormals(worldUp, forwardDir);
+			const FVector upDir = rotQuat.RotateVector(FVector(0.0f, 1.0f, 0.0f));
+			const FVector rightDir = rotQuat.RotateVector(FVector(0.0f, 0.0f, 1.0f));
+
+			//Material tiles once per span whatever its LOD, like one cable per span did
+			const float alongRope = (spanIndex + static_cast<float>(segmentIndex) / span.Segments) * TileMaterial;
+
+			for (int32 side = 0; side < ringVertexCount; side++)
+			{
+				const float alpha = static_cast<float>(side) / NumSides;
+				const float angle = alpha * UE_TWO_PI;
+				const FVector outDir = FMath::Cos(angle) * upDir + FMath::Sin(angle) * rightDir;
+
+				const int32 vertexIndex = i * ringVertexCount + side;
+				_Vertices[vertexIndex] = _Particles[i].Position + outDir * radius;
+				_Normals[vertexIndex] = outDir;
+				_UV0[vertexIndex] = FVector2D(alpha, alongRope);
+				_Tangents[vertexIndex] = FProcMeshTangent(forwardDir, false);
+			}
+		}
+	}
+
+	if(!bTopologyChanged)
+	{
+		UpdateMeshSection(0, _Vertices, _Normals, _UV0, TArray<FColor>(), _Tangents);
+		return;
+	}
+
+	//Rebuild indices only when wrap points or LOD changed
+	_Triangles.Reset((particleCount - 1) * NumSides * 6);
+	for (int32 i = 0; i < particleCount - 1; i++)
+	{
+		for (int32 side = 0; side < NumSides; side++)
+		{
+			const int32 tl = i * ringVertexCount + side;
+			const int32 bl = tl + 1;
+			const int32 tr = tl + ringVertexCount;
+			const int32 br = tr + 1;
+
+			_Triangles.Append({tl, bl, tr});
+			_Triangles.Append({tr, bl, br});
+		}
+	}
+
+	CreateMeshSection(0, _Vertices, _Triangles, _Normals, _UV0, TArray<FColor>(), _Tangents, false);
+	_MeshParticleCount = particleCount;
+}
+
+//------------------
+#pragma endregion Render
@@ -0,0 +1,256 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProceduralMeshComponent.h"
+#include "PS_RopeComponent.generated.h"
+
+// Rope pinned point, follows its component (socket) each frame
+struct FPSRopeAnchor
+{
+	TWeakObjectPtr<USceneComponent> Component;
+
+	FName SocketName = NAME_None;
+
+	// In socket space
+	FVector LocalOffset = FVector::ZeroVector;
+
+	bool operator==(const FPSRopeAnchor& Other) const { return Component == Other.Component && SocketName == Other.SocketName && LocalOffset == Other.LocalOffset; }
+
+	FVector GetLocation() const;
+};
+
+struct FPSRopeParticle
+{
+	FVector Position = FVector::ZeroVector;
+
+	FVector OldPosition = FVector::ZeroVector;
+
+	// Anchor particles are pinned, only the particles of the free spans are simulated
+	bool bFree = true;
+};
+
+// Rope part between two anchors, owns its particles range and simulation state
+struct FPSRopeSpan
+{
+	int32 FirstParticle = 0;
+
+	int32 Segments = 1;
+
+	int32 LODLevel = 0;
+
+	float RestLength = 0.0f;
+
+	// Stretched span drawn as a straight line between its anchors, not simulated
+	bool bTaut = false;
+
+	// At rest span, not simulated until its anchors or length ratio move
+	bool bAsleep = false;
+
+	float RestTime = 0.0f;
+
+	FVector SleepStartLoc = FVector::ZeroVector;
+
+	FVector SleepEndLoc = FVector::ZeroVector;
+
+	float SleepRatio = 1.0f;
+
+	FORCEINLINE bool IsSimulated() const { return !bTaut && !bAsleep; }
+};
+
+/**
+ * Whole hook rope in one component: every span between two anchors (wrap points) lives in one contiguous particle buffer,
+ * is simulated in a single verlet pass and rendered as one tube mesh section.
+ * Each span has its own LOD (segments, solver iterations) from its screen size, the rope tension and the viewer speed.
+ */
+UCLASS(Blueprintable, ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class PROJECTSLICE_API UPS_RopeComponent : public UProceduralMeshComponent
+{
+	GENERATED_BODY()
+
+public:
+	UPS_RopeComponent(const FObjectInitializer& objectInitializer);
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+#pragma region Anchor
+	//------------------
+
+public:
+	// Ordered from the attached object to the hook, spans still linking the same anchors keep their particles
+	void SetAnchors(const TArray<FPSRopeAnchor>& anchors);
+
+	// Rest length of each span relative to the distance between its anchors
+	void SetSpanLengthRatios(const TArray<float>& ratios);
+
+	void ClearAnchors();
+
+	FORCEINLINE int32 GetSpanCount() const { return FMath::Max(_Anchors.Num() - 1, 0); }
+
+	FORCEINLINE const TArray<FPSRopeParticle>& GetParticles() const { return _Particles; }
+
+private:
+	// Layout spans from their LOD, particles of matching old spans are resampled
+	void RebuildParticles(const TArray<FPSRopeAnchor>& oldAnchors, const TArray<FPSRopeSpan>& oldSpans, const TArray<FPSRopeParticle>& oldParticles);
+
+	FORCEINLINE int32 GetAnchorParticleIndex(const int32 anchorIndex) const { return _Spans.IsValidIndex(anchorIndex) ? _Spans[anchorIndex].FirstParticle : _Particles.Num() - 1; }
+
+	FORCEINLINE float GetSpanLengthRatio(const int32 spanIndex) const { return _SpanLengthRatios.IsValidIndex(spanIndex) ? _SpanLengthRatios[spanIndex] : 1.0f; }
+
+	UPROPERTY(Transient)
+	TArray<float> _SpanLengthRatios;
+
+	TArray<FPSRopeAnchor> _Anchors;
+
+	//------------------
+#pragma endregion Anchor
+
+#pragma region Simulation
+	//------------------
+
+protected:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Parameters|Simulation", meta=(UIMin="1", ClampMin="1", ToolTip="Segments per span between two wrap points"))
+	int32 SegmentsPerSpan = 10;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Parameters|Simulation", meta=(UIMin="1", ClampMin="1", UIMax="16", ClampMax="16"))
+	int32 SolverIterations = 4;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Parameters|Simulation", meta=(UIMin="0.005", ClampMin="0.005", ForceUnits="s"))
+	float SubstepTime = 0.02f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Parameters|Simulation")
+	float GravityScale = 1.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Parameters|Simulation", meta=(UIMin="0", ClampMin="0", UIMax="1", ClampMax="1"))
+	float Damping = 0.02f;
+
+private:
+	void UpdateAnchorParticles();
+
+	void VerletIntegrate(const float substepTime, const FVector& gravity);
+
+	void SolveConstraints();
+
+	UPROPERTY(Transient)
+	float _TimeRemainder = 0.0f;
+
+	TArray<FPSRopeParticle> _Particles;
+
+	TArray<FPSRopeSpan> _Spans;
+
+	//------------------
+#pragma endregion Simulation
+
+#pragma region LOD
+	//------------------
+
+public:
+	/*
+	 * @brief Per frame LOD inputs, fed by the hook
+	 * @param tenseAlpha: rope tension, 0 slack, 1 fully stretched
+	 * @param viewerSpeed: player velocity length
+	 */
+	void SetLODInputs(const float tenseAlpha, const float viewerSpeed);
+
+protected:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Parameters|LOD")
+	bool bEnableLOD = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Parameters|LOD", meta=(UIMin="1", ClampMin="1", ToolTip="Segments per span at the lowest LOD"))
+	int32 MinSegmentsPerSpan = 3;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Parameters|LOD", meta=(UIMin="1", ClampMin="1", ToolTip="Solver iterations at the lowest LOD"))
+	int32 MinSolverIterations = 1;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Parameters|LOD", meta=(UIMin="0", ClampMin="0", ToolTip="Span screen size (half length / view distance) under which the span use the lowest LOD"))
+	float LowLODScreenSize = 0.05f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Parameters|LOD", meta=(UIMin="0", ClampMin="0", ToolTip="Span screen size over which the span use the full LOD"))
+	float FullLODScreenSize = 0.3f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Parameters|LOD", meta=(UIMin="0", ClampMin="0", ForceUnits="cm/s", ToolTip="Viewer speed over which the rope use the lowest LOD"))
+	float LowLODViewerSpeed = 2000.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Parameters|LOD", meta=(UIMin="0", ClampMin="0", UIMax="1", ClampMax="1", ToolTip="Tension over which spans not longer than their anchors distance are drawn straight"))
+	float TautTenseThreshold = 0.9f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Parameters|LOD|Sleep", meta=(UIMin="0", ClampMin="0", ForceUnits="cm/s"))
+	float SleepSpeedThreshold = 2.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Parameters|LOD|Sleep", meta=(UIMin="0", ClampMin="0", ForceUnits="s"))
+	float SleepDelay = 0.5f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Parameters|LOD|Sleep", meta=(UIMin="0", ClampMin="0", ForceUnits="cm", ToolTip="Anchor move waking up a sleeping span"))
+	float WakeAnchorDistance = 1.0f;
+
+private:
+	void UpdateView();
+
+	// Level from span screen size, tension and viewer speed. Hysteresis around the current level, none if INDEX_NONE
+	int32 ComputeSpanLODLevel(const FVector& startLoc, const FVector& endLoc, const int32 currentLevel) const;
+
+	int32 GetLODSegments(const int32 lodLevel) const;
+
+	int32 GetLODSolverIterations(const int32 lodLevel) const;
+
+	// Resample spans whose LOD level changed
+	void UpdateSpanLODs();
+
+	// Straighten taut spans, put at rest spans to sleep. Return true if the mesh must be rebuilt
+	bool UpdateSpanStates(const float deltaTime, const bool bHasStepped);
+
+	static void WakeSpan(FPSRopeSpan& span);
+
+	static constexpr int32 LODLevelCount = 3;
+
+	static constexpr float LODHysteresis = 0.15f;
+
+	UPROPERTY(Transient)
+	float _TenseAlpha = 0.0f;
+
+	UPROPERTY(Transient)
+	float _ViewerSpeed = 0.0f;
+
+	UPROPERTY(Transient)
+	FVector _ViewLoc = FVector::ZeroVector;
+
+	UPROPERTY(Transient)
+	float _ViewTanHalfFOV = 1.0f;
+
+	//------------------
+#pragma endregion LOD
+
+#pragma region Render
+	//------------------
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Parameters|Render", meta=(UIMin="0.01", ClampMin="0.01", ForceUnits="cm"))
+	float RopeWidth = 2.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Parameters|Render", meta=(UIMin="3", ClampMin="3", UIMax="16", ClampMax="16"))
+	int32 NumSides = 6;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Parameters|Render", meta=(UIMin="0.1", ClampMin="0.1"))
+	float TileMaterial = 1.0f;
+
+protected:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Debug")
+	bool bDebug = false;
+
+private:
+	void BuildMesh();
+
+	// Section is recreated only when the particle count changes, updated in place otherwise
+	UPROPERTY(Transient)
+	int32 _MeshParticleCount = 0;
+
+	TArray<FVector> _Vertices;
+	TArray<int32> _Triangles;
+	TArray<FVector> _Normals;
+	TArray<FVector2D> _UV0;
+	TArray<FProcMeshTangent> _Tangents;
+
+	//------------------
+#pragma endregion Render
+};
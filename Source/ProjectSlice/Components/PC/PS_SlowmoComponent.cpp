@@ -6,8 +6,73 @@
 #include "PS_PlayerCameraComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "Kismet/KismetMathLibrary.h"
+#include "PBDRigidsSolver.h"
+#include "Physics/Experimental/PhysScene_Chaos.h"
 #include "ProjectSlice/Character/PC/PS_Character.h"
 #include "ProjectSlice/FunctionLibrary/PSFl.h"
+#include "ProjectSlice/System/PS_DilatedVelocitySimCallback.h"
+#include "ProjectSlice/System/PS_SlowmoVolumeSubsystem.h"
+
+#pragma region DilatedActorRegistry
+//------------------
+
+int32 FPSDilatedActorRegistry::Add(AActor* actor, const float dilation, const FVector& enterVelocity, const FVector& enterAngularVelocity)
+{
+	if (const int32* existingSlot = _SlotByActor.Find(actor)) return *existingSlot;
+
+	const int32 slot = Actors.Add(actor);
+	Dilations.Add(dilation);
+	EnterVelocities.Add(enterVelocity);
+	EnterAngularVelocities.Add(enterAngularVelocity);
+
+	//Simulating components are gathered once, not at each clamp
+	FPSDilatedComponents& components = Components.AddDefaulted_GetRef();
+	const TInlineComponentArray<UPrimitiveComponent*> primitives(actor);
+	for (UPrimitiveComponent* primitive : primitives)
+	{
+		if (IsValid(primitive) && primitive->IsSimulatingPhysics()) components.Add(primitive);
+	}
+
+	_Keys.Add(actor);
+	_SlotByActor.Add(actor, slot);
+	return slot;
+}
+
+bool FPSDilatedActorRegistry::Remove(const AActor* actor)
+{
+	int32 slot = INDEX_NONE;
+	if (!_SlotByActor.RemoveAndCopyValue(actor, slot)) return false;
+
+	//Last slot moves into the removed one
+	const int32 lastSlot = Actors.Num() - 1;
+	if (slot != lastSlot)
+	{
+		_SlotByActor.Add(_Keys[lastSlot], slot);
+	}
+
+	Actors.RemoveAtSwap(slot, 1, EAllowShrinking::No);
+	Dilations.RemoveAtSwap(slot, 1, EAllowShrinking::No);
+	EnterVelocities.RemoveAtSwap(slot, 1, EAllowShrinking::No);
+	EnterAngularVelocities.RemoveAtSwap(slot, 1, EAllowShrinking::No);
+	Components.RemoveAtSwap(slot, 1, EAllowShrinking::No);
+	_Keys.RemoveAtSwap(slot, 1, EAllowShrinking::No);
+
+	return true;
+}
+
+void FPSDilatedActorRegistry::Reset()
+{
+	Actors.Reset();
+	Dilations.Reset();
+	EnterVelocities.Reset();
+	EnterAngularVelocities.Reset();
+	Components.Reset();
+	_Keys.Reset();
+	_SlotByActor.Reset();
+}
+
+//------------------
+#pragma endregion DilatedActorRegistry
 
 // Sets default values for this component's properties
 UPS_SlowmoComponent::UPS_SlowmoComponent()
@@ -25,6 +90,7 @@ void UPS_SlowmoComponent::BeginPlay()
 	Super::BeginPlay();
 
 	SetComponentTickEnabled(false);
+	BakeCurves();
 
 	//Init default Variable
 	_PlayerCharacter = Cast<AProjectSliceCharacter>(UGameplayStatics::GetPlayerCharacter(GetWorld(), 0));
@@ -33,14 +99,40 @@ void UPS_SlowmoComponent::BeginPlay()
 	_PlayerController = Cast<AProjectSlicePlayerController>(_PlayerCharacter->GetController());
 	if(!IsValid(_PlayerController))return;
 
+	_TimerSubsystem = UPS_TimerSubsystem::Get(this);
+	_SlowmoVolumeSubsystem = IsValid(GetWorld()) ? GetWorld()->GetSubsystem<UPS_SlowmoVolumeSubsystem>() : nullptr;
+
+	//Dilated bodies velocity is clamped by the physics steps
+	if(IsValid(GetWorld()) && GetWorld()->GetPhysicsScene())
+	{
+		if(Chaos::FPhysicsSolver* solver = GetWorld()->GetPhysicsScene()->GetSolver())
+		{
+			_VelocitySimCallback = solver->CreateAndRegisterSimCallbackObject_External<FPSDilatedVelocitySimCallback>();
+		}
+	}
+
 	_DefaultPlayerTimeDilation = _PlayerCharacter->GetActorTimeDilation();
 	if(IsValid(GetWorld()))
 	{
 		_DefaultGlobalTimeDilation = UGameplayStatics::GetGlobalTimeDilation(GetWorld());
 	}
+}
 
+void UPS_SlowmoComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if(_VelocitySimCallback && IsValid(GetWorld()) && GetWorld()->GetPhysicsScene())
+	{
+		if(Chaos::FPhysicsSolver* solver = GetWorld()->GetPhysicsScene()->GetSolver())
+		{
+			solver->UnregisterAndFreeSimCallbackObject_External(_VelocitySimCallback);
+		}
+	}
+	_VelocitySimCallback = nullptr;
+	_PendingExitClamps.Empty();
+	_PendingDilatedActors.Empty();
+	_CurveLUTs.Reset();
 
-
+	Super::EndPlay(EndPlayReason);
 }
 
 // Called every frame
@@ -48,11 +140,25 @@ void UPS_SlowmoComponent::TickComponent(float DeltaTime, ELevelTick TickType,
 	FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-	
-	if(!_bIsSlowmoTransiting && IsComponentTickEnabled())
+
+	ApplyPendingDilatedActors();
+
+	//Keep ticking while physics steps need limits
+	const bool bNeedVelocityLimits = !_PendingExitClamps.IsEmpty() || (HasDilatedSpeedLimit() && _DilatedActors.Num() > 0);
+	if(!_bIsSlowmoTransiting && !bNeedVelocityLimits && IsComponentTickEnabled())
 		SetComponentTickEnabled(false);
 	
 	SlowmoTransition();
+	PushVelocityLimits();
+}
+
+void UPS_SlowmoComponent::BakeCurves()
+{
+	_CurveLUTs.Init(static_cast<int32>(EPSSlowmoCurveSlot::Count));
+	_CurveLUTs.Bake(static_cast<int32>(EPSSlowmoCurveSlot::GlobalDilation), SlowmoGlobalDilationCurve);
+	_CurveLUTs.Bake(static_cast<int32>(EPSSlowmoCurveSlot::PlayerDilation), SlowmoPlayerDilationCurve);
+	_CurveLUTs.Bake(static_cast<int32>(EPSSlowmoCurveSlot::PostProcessIn), SlowmoPostProcessCurves.IsValidIndex(0) ? SlowmoPostProcessCurves[0] : nullptr);
+	_CurveLUTs.Bake(static_cast<int32>(EPSSlowmoCurveSlot::PostProcessOut), SlowmoPostProcessCurves.IsValidIndex(1) ? SlowmoPostProcessCurves[1] : nullptr);
 }
 
 void UPS_SlowmoComponent::SlowmoTransition()
@@ -66,27 +172,13 @@ void UPS_SlowmoComponent::SlowmoTransition()
 		//Time Dilation alpha
 		const float alpha = UKismetMathLibrary::MapRangeClamped(_SlowmoTime, _StartSlowmoTimestamp ,_StartSlowmoTimestamp + _SlowmoTransitionDuration,0.0,1.0);
 	
-		//Curve alpha
-		float curveGlobalAlpha = alpha;
-		if(IsValid(SlowmoGlobalDilationCurve))
-		{
-			curveGlobalAlpha = SlowmoGlobalDilationCurve->GetFloatValue(alpha);
-		}
-
-		float curvePlayerAlpha = alpha;
-		if(IsValid(SlowmoPlayerDilationCurve))
-		{
-			curvePlayerAlpha = SlowmoPlayerDilationCurve->GetFloatValue(alpha);
-		}
+		//Curve alpha, missing curves are baked linear
+		const float curveGlobalAlpha = EvaluateCurve(EPSSlowmoCurveSlot::GlobalDilation, alpha);
+		const float curvePlayerAlpha = EvaluateCurve(EPSSlowmoCurveSlot::PlayerDilation, alpha);
 
 		//Set PostProccess alpha
 		_PlayerSlowmoAlpha = _bSlowming ? curvePlayerAlpha : 1.0f - curvePlayerAlpha;
-		_SlowmoPostProcessAlpha = _PlayerSlowmoAlpha;
-		UCurveFloat* currentCurve = SlowmoPostProcessCurves.IsValidIndex(_bSlowming ? 0 : 1) ? SlowmoPostProcessCurves[_bSlowming ? 0 : 1] : nullptr ;
-		if(IsValid(currentCurve))
-		{
-			_SlowmoPostProcessAlpha = currentCurve->GetFloatValue(_PlayerSlowmoAlpha);
-		}
+		_SlowmoPostProcessAlpha = EvaluateCurve(_bSlowming ? EPSSlowmoCurveSlot::PostProcessIn : EPSSlowmoCurveSlot::PostProcessOut, _PlayerSlowmoAlpha);
 	
 		//Set time Dilation
 		float globalDilationTarget = _bSlowming ? GlobalTimeDilationTarget : 1.0f;
@@ -100,6 +192,7 @@ void UPS_SlowmoComponent::SlowmoTransition()
 		
 		UGameplayStatics::SetGlobalTimeDilation(GetWorld(), globalTimeDilation);
 		_PlayerCharacter->SetPlayerTimeDilation(_CurrentPlayerTimeDilation);
+		if(IsValid(_TimerSubsystem)) _TimerSubsystem->NotifyTimeDilationChanged();
 		if(bDebug) UE_LOG(LogTemp, Log, TEXT("%S :: alpha %f, alphaGlobal %f, globalDilation %f, customTimeDilation %f, playerTimeDilation %f "),  __FUNCTION__,alpha, alpha, UGameplayStatics::GetGlobalTimeDilation(GetWorld()), _PlayerCharacter->CustomTimeDilation, _PlayerCharacter->GetActorTimeDilation());
 
 		//Exit or trigger Slowmo timer
@@ -152,16 +245,10 @@ void UPS_SlowmoComponent::OnTriggerSlowmo()
 	_bSlowming = !_bSlowming;
 	GetWorld()->GetTimerManager().ClearTimer(_SlowmoTimerHandle);
 
-	//For each dilated actor update custom dilation
-	const TArray<FSSlowmotionData> actorsArray = _ActorsDilated;
+	//Reset every dilated actor in one pass
 	if (!_bSlowming)
 	{
-		for (FSSlowmotionData actorDilated : actorsArray)
-		{
-			if (!IsValid(actorDilated.Actor)) continue;
-			
-			UpdateObjectDilation(actorDilated.Actor);
-		}
+		RestoreDilatedActors();
 	}
 
 	//Start player dilation &&& global dilation transition
@@ -184,33 +271,115 @@ void UPS_SlowmoComponent::OnTriggerSlowmo()
 	if(bDebug) UE_LOG(LogTemp, Log, TEXT("%S :: %s"), __FUNCTION__, _bSlowming ? TEXT("On") :  TEXT("Off"));
 }
 
-void UPS_SlowmoComponent::ClampPhysicalVelocity(AActor* actorToUpdate, int32 currentIndex)
+void UPS_SlowmoComponent::ApplyPendingDilatedActors()
 {
-	if (!IsValid(actorToUpdate) || !IsValid(actorToUpdate->GetWorld())) return;
-	
-	TArray<UPrimitiveComponent*> actorsToClampVel;
-	UPSFl::GetActivePhysicsComponents(actorToUpdate, actorsToClampVel);
+	if (_PendingDilatedActors.IsEmpty()) return;
 
-	for (UPrimitiveComponent* actorToClampVelElement : actorsToClampVel)
+	if (bDebug) UE_LOG(LogTemp, Log, TEXT("%S :: %i actors"), __FUNCTION__, _PendingDilatedActors.Num());
+
+	const float timeDilation = InteractedObjectTimeDilationTarget * GetRealPlayerTimeDilationTarget();
+	for (const FPSPendingDilatedActor& pendingActor : _PendingDilatedActors)
 	{
-		if (!IsValid(actorToClampVelElement)) continue;
-		
-		//Translation
-		//float  newSpeed = UKismetMathLibrary::Clamp(actorToClampVelElement->GetPhysicsLinearVelocity().Length(), 0.0f, _ActorsDilated[currentIndex].EnterVelocity.Length() * 1.5f);
-		float  newSpeed = UKismetMathLibrary::Clamp(actorToClampVelElement->GetPhysicsLinearVelocity().Length(), _ActorsDilated[currentIndex].EnterVelocity.Length(), actorToClampVelElement->GetPhysicsLinearVelocity().Length() / actorToUpdate->CustomTimeDilation);
-		FVector newVel = actorToClampVelElement->GetPhysicsLinearVelocity().GetSafeNormal() * newSpeed;
-		actorToClampVelElement->SetAllPhysicsLinearVelocity(newVel);
-
-		//Rotation
-		FVector currentAngVel = actorToClampVelElement->GetPhysicsAngularVelocityInRadians();
-		//float newAngSpeed = UKismetMathLibrary::Clamp(currentAngVel.Length(),0.0f, _ActorsDilated[currentIndex].EnterAngularVelocity.Length());
-		float newAngSpeed = UKismetMathLibrary::Clamp(currentAngVel.Length(),_ActorsDilated[currentIndex].EnterAngularVelocity.Length(), currentAngVel.Length() / actorToUpdate->CustomTimeDilation);
-		FVector newAngVel = currentAngVel.GetSafeNormal() * newAngSpeed;
-		actorToClampVelElement->SetPhysicsAngularVelocityInRadians(newAngVel, false);
-
-		if (bDebug) UE_LOG(LogTemp, Log, TEXT("%S :: %s clampedVel %f, clampedAngularVel %f"),__FUNCTION__,*actorToClampVelElement->GetReadableName(), newVel.Length(), newAngVel.Length());
+		AActor* actorToUpdate = pendingActor.Actor.Get();
+		if (!IsValid(actorToUpdate) || actorToUpdate->IsActorBeingDestroyed() || _DilatedActors.Find(actorToUpdate) != INDEX_NONE) continue;
+
+		actorToUpdate->CustomTimeDilation = timeDilation;
+		_DilatedActors.Add(actorToUpdate, timeDilation, pendingActor.EnterVelocity, pendingActor.EnterAngularVelocity);
 	}
-	
+	_PendingDilatedActors.Reset();
+
+	if (IsValid(_TimerSubsystem)) _TimerSubsystem->NotifyTimeDilationChanged();
+}
+
+void UPS_SlowmoComponent::RestoreDilatedActors()
+{
+	//Queued pushes of this slowmo are dropped, never dilated after it
+	_PendingDilatedActors.Reset();
+
+	if (_DilatedActors.Num() == 0) return;
+
+	if (bDebug) UE_LOG(LogTemp, Log, TEXT("%S :: %i actors"), __FUNCTION__, _DilatedActors.Num());
+
+	for (int32 slot = 0; slot < _DilatedActors.Num(); ++slot)
+	{
+		RestoreDilatedSlot(slot);
+	}
+	_DilatedActors.Reset();
+
+	if (IsValid(_TimerSubsystem)) _TimerSubsystem->NotifyTimeDilationChanged();
+}
+
+void UPS_SlowmoComponent::RestoreDilatedSlot(const int32 slot)
+{
+	AActor* actorToUpdate = _DilatedActors.Actors[slot].Get();
+	if (!IsValid(actorToUpdate) || actorToUpdate->IsActorBeingDestroyed()) return;
+
+	actorToUpdate->CustomTimeDilation = GetRestDilation(actorToUpdate);
+
+	//Dilated object who's currently moving on slowmo stop keeps at least its enter speed, clamped by the next physics step
+	const float enterSpeed = _DilatedActors.EnterVelocities[slot].Length();
+	const float enterAngularSpeed = _DilatedActors.EnterAngularVelocities[slot].Length();
+	for (const TWeakObjectPtr<UPrimitiveComponent>& componentPtr : _DilatedActors.Components[slot])
+	{
+		if (!componentPtr.IsValid()) continue;
+
+		FPSDilatedExitClamp& exitClamp = _PendingExitClamps.AddDefaulted_GetRef();
+		exitClamp.Component = componentPtr;
+		exitClamp.MinLinearSpeed = enterSpeed;
+		exitClamp.MinAngularSpeed = enterAngularSpeed;
+
+		if (bDebug) UE_LOG(LogTemp, Log, TEXT("%S :: %s minVel %f, minAngularVel %f"),__FUNCTION__,*componentPtr->GetReadableName(), enterSpeed, enterAngularSpeed);
+	}
+}
+
+float UPS_SlowmoComponent::GetRestDilation(const AActor* actor) const
+{
+	return IsValid(_SlowmoVolumeSubsystem) ? _SlowmoVolumeSubsystem->GetVolumeDilation(actor) : 1.0f;
+}
+
+void UPS_SlowmoComponent::PushVelocityLimits()
+{
+	const bool bLimitDilated = HasDilatedSpeedLimit() && _DilatedActors.Num() > 0;
+	if (!_VelocitySimCallback || (!bLimitDilated && _PendingExitClamps.IsEmpty()))
+	{
+		_PendingExitClamps.Reset();
+		return;
+	}
+
+	//Handles are resolved each frame, a body can be recreated while registered
+	const auto getPhysicsHandle = [](const UPrimitiveComponent* component) -> FPhysicsActorHandle
+	{
+		if (!IsValid(component) || !component->IsSimulatingPhysics()) return nullptr;
+		const FBodyInstance* bodyInstance = component->GetBodyInstance();
+		return bodyInstance ? bodyInstance->GetPhysicsActorHandle() : nullptr;
+	};
+
+	FPSDilatedVelocityInput* input = _VelocitySimCallback->GetProducerInputData_External();
+
+	if (bLimitDilated)
+	{
+		for (int32 slot = 0; slot < _DilatedActors.Num(); ++slot)
+		{
+			FPSBodyVelocityLimit limit;
+			limit.MaxLinearSpeed = MaxDilatedLinearSpeed * _DilatedActors.Dilations[slot];
+			limit.MaxAngularSpeed = FMath::DegreesToRadians(MaxDilatedAngularSpeed) * _DilatedActors.Dilations[slot];
+
+			for (const TWeakObjectPtr<UPrimitiveComponent>& componentPtr : _DilatedActors.Components[slot])
+			{
+				limit.PhysicsHandle = getPhysicsHandle(componentPtr.Get());
+				if (limit.PhysicsHandle) input->Bodies.Add(limit);
+			}
+		}
+	}
+
+	for (const FPSDilatedExitClamp& exitClamp : _PendingExitClamps)
+	{
+		FPSBodyVelocityLimit& limit = input->Bodies.AddDefaulted_GetRef();
+		limit.PhysicsHandle = getPhysicsHandle(exitClamp.Component.Get());
+		limit.MinLinearSpeed = exitClamp.MinLinearSpeed;
+		limit.MinAngularSpeed = exitClamp.MinAngularSpeed;
+	}
+	_PendingExitClamps.Reset();
 }
 
 void UPS_SlowmoComponent::UpdateObjectDilation(AActor* actorToUpdate, const UMeshComponent* mesComp)
@@ -219,50 +388,39 @@ void UPS_SlowmoComponent::UpdateObjectDilation(AActor* actorToUpdate, const UMes
 
 	//Work var
 	const float timeDilation = InteractedObjectTimeDilationTarget * GetRealPlayerTimeDilationTarget();
-	const float currentTargetDilation = _bSlowming ? timeDilation : 1.0f;
+	const float currentTargetDilation = _bSlowming ? timeDilation : GetRestDilation(actorToUpdate);
 	if (actorToUpdate->CustomTimeDilation == currentTargetDilation) return;
 
-	//Apply dilation
-	actorToUpdate->CustomTimeDilation = currentTargetDilation;
-
 	//Debug
 	if (bDebug) UE_LOG(LogTemp, Log, TEXT("%S :: %s dilation: %f "),__FUNCTION__, *actorToUpdate->GetActorNameOrLabel(), currentTargetDilation);
 
-	//Stock or Erase to Queue
+	//Registrations are applied together from tick, with a single notify
 	if (_bSlowming)
 	{
-		//Set Slowmo data
-		FSSlowmotionData newActorDilated;
-		newActorDilated.Actor = actorToUpdate;
-		newActorDilated.EnterVelocity = actorToUpdate->GetVelocity();
-		
-		if (IsValid(mesComp))
-		{
-			newActorDilated.EnterVelocity = mesComp->GetComponentVelocity();
-			newActorDilated.EnterAngularVelocity = mesComp->GetPhysicsAngularVelocityInRadians();
-		}
+		FPSPendingDilatedActor& pendingActor = _PendingDilatedActors.AddDefaulted_GetRef();
+		pendingActor.Actor = actorToUpdate;
+		pendingActor.EnterVelocity = IsValid(mesComp) ? mesComp->GetComponentVelocity() : actorToUpdate->GetVelocity();
+		pendingActor.EnterAngularVelocity = IsValid(mesComp) ? mesComp->GetPhysicsAngularVelocityInRadians() : FVector::ZeroVector;
 
-		//Add object to list
-		_ActorsDilated.AddUnique(newActorDilated);
+		SetComponentTickEnabled(true);
+		return;
+	}
+
+	//Restore
+	const int32 slot = _DilatedActors.Find(actorToUpdate);
+	if (slot == INDEX_NONE)
+	{
+		actorToUpdate->CustomTimeDilation = currentTargetDilation;
+		UE_LOG(LogTemp, Warning, TEXT("%S :: %s is not in _DilatedActors registry "),__FUNCTION__, *actorToUpdate->GetActorNameOrLabel());
 	}
 	else
 	{
-		//Get Index in Array list
-		int32 currentIndex = _ActorsDilated.IndexOfByPredicate([actorToUpdate](const FSSlowmotionData& Data) { return Data.Actor == actorToUpdate; });
-		if (!_ActorsDilated.IsValidIndex(currentIndex))
-		{
-			UE_LOG(LogTemp, Warning, TEXT("%S :: %s is not in _ActorsDilated array "),__FUNCTION__, *actorToUpdate->GetActorNameOrLabel());
-			return;
-		}
-		
-		//Clamp Physic Vel of Dilated object who's currently moving on slowmo stop
-		ClampPhysicalVelocity(actorToUpdate, currentIndex);
-
-		//Remove object from list
-		_ActorsDilated.RemoveAt(currentIndex);
+		RestoreDilatedSlot(slot);
+		_DilatedActors.Remove(actorToUpdate);
 	}
-}
-
-
 
+	//Physics limits are pushed from tick
+	if (HasDilatedSpeedLimit() || !_PendingExitClamps.IsEmpty()) SetComponentTickEnabled(true);
 
+	if (IsValid(_TimerSubsystem)) _TimerSubsystem->NotifyTimeDilationChanged();
+}
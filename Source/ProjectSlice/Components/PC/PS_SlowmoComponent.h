@@ -4,48 +4,89 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "UObject/ObjectKey.h"
 #include "ProjectSlice/Data/PS_Delegates.h"
+#include "ProjectSlice/FunctionLibrary/PSFL_CurveLUT.h"
 #include "PS_SlowmoComponent.generated.h"
 
 class AProjectSlicePlayerController;
 class AProjectSliceCharacter;
+class UPS_TimerSubsystem;
+class FPSDilatedVelocitySimCallback;
+class UPS_SlowmoVolumeSubsystem;
 
 
-USTRUCT(BlueprintType, Category = "Slowmotion", meta = (ToolTip="Slowmotion data"))
-struct PROJECTSLICE_API FSSlowmotionData
+// Simulating components of a dilated actor, gathered once at registration
+using FPSDilatedComponents = TArray<TWeakObjectPtr<UPrimitiveComponent>, TInlineAllocator<2>>;
+
+/**
+ * Dilated actors registry: actor to dense slot map, per slot data in parallel arrays.
+ * Removal swap the last slot in, so every array stay dense and a pass over all actors is linear.
+ */
+USTRUCT()
+struct PROJECTSLICE_API FPSDilatedActorRegistry
 {
 	GENERATED_BODY()
 
 public:
-	FSSlowmotionData(){};
-	
-	FSSlowmotionData(AActor* actor, const FVector& enterVelocity){Actor = actor, EnterVelocity = enterVelocity;};
+	// Return the slot of actor, added if missing
+	int32 Add(AActor* actor, const float dilation, const FVector& enterVelocity, const FVector& enterAngularVelocity);
+
+	// Return false if actor isn't registered
+	bool Remove(const AActor* actor);
+
+	FORCEINLINE int32 Find(const AActor* actor) const { const int32* slot = _SlotByActor.Find(actor); return slot ? *slot : INDEX_NONE; }
+
+	FORCEINLINE int32 Num() const { return Actors.Num(); }
+
+	void Reset();
+
+	UPROPERTY(Transient)
+	TArray<TWeakObjectPtr<AActor>> Actors;
+
+	TArray<float> Dilations;
+
+	TArray<FVector> EnterVelocities;
+
+	TArray<FVector> EnterAngularVelocities;
+
+	TArray<FPSDilatedComponents> Components;
+
+private:
+	// Keys kept per slot, a destroyed actor can still be moved or removed
+	TArray<TObjectKey<AActor>> _Keys;
+
+	TMap<TObjectKey<AActor>, int32> _SlotByActor;
+};
+
+// Transition curves baked in _CurveLUTs
+enum class EPSSlowmoCurveSlot : uint8
+{
+	GlobalDilation,
+	PlayerDilation,
+	PostProcessIn,
+	PostProcessOut,
+	Count
+};
+
+// Push registration, applied with the others on the next tick. Enter velocities are read at the push
+struct FPSPendingDilatedActor
+{
+	TWeakObjectPtr<AActor> Actor;
 
-	UPROPERTY()
-	AActor* Actor = nullptr;
-	
-	UPROPERTY()
 	FVector EnterVelocity = FVector::ZeroVector;
 
-	UPROPERTY()
 	FVector EnterAngularVelocity = FVector::ZeroVector;
-	
-	// friend uint32 GetTypeHash(const FSWindZoneData& other)
-	// {
-	// 	return GetTypeHash(other.OwningPawn);
-	// }
-	//
-	
-	bool operator == (const FSSlowmotionData& other) const
-	{
-		return Actor == other.Actor;
-	}
-
-	bool operator == (const AActor* other) const
-	{
-		return Actor == other;
-	}
-	
+};
+
+// Restored component speed floor, sent with the next physics input
+struct FPSDilatedExitClamp
+{
+	TWeakObjectPtr<UPrimitiveComponent> Component;
+
+	float MinLinearSpeed = 0.0f;
+
+	float MinAngularSpeed = 0.0f;
 };
 
 UCLASS(Blueprintable, ClassGroup=(Component), meta=(BlueprintSpawnableComponent))
@@ -61,6 +102,8 @@ protected:
 	// Called when the game starts
 	virtual void BeginPlay() override;
 
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="Debug")
 	bool bDebug = false;
 
@@ -76,6 +119,12 @@ private:
 	UPROPERTY(Transient)
 	AProjectSlicePlayerController* _PlayerController;
 
+	UPROPERTY(Transient)
+	UPS_TimerSubsystem* _TimerSubsystem;
+
+	UPROPERTY(Transient)
+	UPS_SlowmoVolumeSubsystem* _SlowmoVolumeSubsystem;
+
 #pragma region Routine
 	//------------------
 
@@ -98,8 +147,7 @@ public:
 	UFUNCTION()
 	void UpdateObjectDilation(AActor* actorToUpdate, const UMeshComponent* mesComp = nullptr);
 
-	UFUNCTION()
-	void ClampPhysicalVelocity(AActor* actorToUpdate, int32 currentIndex);
+	FORCEINLINE const FPSDilatedActorRegistry& GetDilatedActors() const { return _DilatedActors; }
 	
 	UFUNCTION(BlueprintCallable)
 	FORCEINLINE bool IsSlowmoActive() const{return _bIsSlowmoTransiting || _bSlowming;}
@@ -132,6 +180,28 @@ protected:
 
 	UFUNCTION()
 	void SlowmoTransition();
+
+	// Dilate and register every queued actor in one pass
+	void ApplyPendingDilatedActors();
+
+	// Reset dilation of every registered actor and clamp their velocities in one pass
+	void RestoreDilatedActors();
+
+	// Dilation of actor outside of push slowmo, given by the slowmo volumes around it
+	float GetRestDilation(const AActor* actor) const;
+
+	// Reset dilation of slot actor and queue its physic velocity clamp, slot stay registered
+	void RestoreDilatedSlot(const int32 slot);
+
+	// Send dilated bodies speed caps and pending exit clamps to the physics steps
+	void PushVelocityLimits();
+
+	// Sample transition curves, evaluated from LUTs each tick
+	void BakeCurves();
+
+	FORCEINLINE float EvaluateCurve(const EPSSlowmoCurveSlot slot, const float alpha) const { return _CurveLUTs.Evaluate(static_cast<int32>(slot), alpha); }
+
+	FORCEINLINE bool HasDilatedSpeedLimit() const { return MaxDilatedLinearSpeed > 0.0f || MaxDilatedAngularSpeed > 0.0f; }
 	
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Parameters|Slowmo")
 	float GlobalTimeDilationTarget = 0.3f;
@@ -156,6 +226,12 @@ protected:
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Parameters|Slowmo|Transition")
 	UCurveFloat* SlowmoPlayerDilationCurve;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Parameters|Slowmo|Physic", meta=(UIMin="0", ClampMin="0", ForceUnits="cm/s", ToolTip="Dilated object max speed at dilation 1, scaled by its dilation. 0 for no limit"))
+	float MaxDilatedLinearSpeed = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Parameters|Slowmo|Physic", meta=(UIMin="0", ClampMin="0", ForceUnits="deg/s", ToolTip="Dilated object max angular speed at dilation 1, scaled by its dilation. 0 for no limit"))
+	float MaxDilatedAngularSpeed = 0.0f;
 		
 private:
 	UPROPERTY(Transient)
@@ -195,7 +271,16 @@ private:
 	float _CurrentPlayerTimeDilation;
 
 	UPROPERTY(Transient)
-	TArray<FSSlowmotionData> _ActorsDilated;
+	FPSDilatedActorRegistry _DilatedActors;
+
+	FPSCurveLUTStore _CurveLUTs;
+
+	TArray<FPSDilatedExitClamp> _PendingExitClamps;
+
+	TArray<FPSPendingDilatedActor> _PendingDilatedActors;
+
+	// Owned by the physics solver, registered at BeginPlay
+	FPSDilatedVelocitySimCallback* _VelocitySimCallback = nullptr;
 
 #pragma endregion Routine
 
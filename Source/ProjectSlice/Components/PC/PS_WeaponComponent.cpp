@@ -63,6 +63,8 @@ void UPS_WeaponComponent::BeginPlay()
 		GetWorld()->GetTimerManager().SetTimer(_RackTickTimerHandle, wallRunTick_TimerDelegate, RackTickRate, true);
 		GetWorld()->GetTimerManager().PauseTimer(_RackTickTimerHandle);
 	}
+
+	PrewarmImpactFields();
 }
 
 void UPS_WeaponComponent::TickComponent(float DeltaTime, ELevelTick TickType,
@@ -305,12 +307,6 @@ void UPS_WeaponComponent::GenerateImpactField(const FHitResult& targetHit, const
 		return;
 	}
 	
-	//Spawn param
-	FActorSpawnParameters SpawnInfo;
-	SpawnInfo.Owner = _PlayerCharacter;
-	SpawnInfo.Instigator = _PlayerCharacter;
-	SpawnInfo.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-
 	//Determine base loc && rot
 	FVector loc =  targetHit.Location + UKismetMathLibrary::GetDirectionUnitVector(targetHit.TraceStart, targetHit.Location) * 100;
 	FRotator rot = UKismetMathLibrary::FindLookAtRotation(targetHit.TraceStart, targetHit.Location);
@@ -318,7 +314,7 @@ void UPS_WeaponComponent::GenerateImpactField(const FHitResult& targetHit, const
 
 	DrawDebugLine(GetWorld(), loc, loc + rot.Vector() * 500, FColor::Yellow, false, 2, 10, 3);
 	
-	_ImpactField = GetWorld()->SpawnActor<APS_FieldSystemActor>(FieldSystemActor.Get(), loc, rot, SpawnInfo);
+	_ImpactField = AcquireImpactField(FTransform(rot, loc), _PlayerCharacter);
 	if(!IsValid(_ImpactField)) return;
 
 	//Rotatation local for plane
@@ -571,7 +567,8 @@ void UPS_WeaponComponent::AdaptSightMeshBound(const bool& bForce)
 {
 	if (!IsValid(_PlayerCamera) || !IsValid(_PlayerCharacter) || !IsValid(SightMesh)) return;
 	
-	if (_LastSightTarget.Equals(_SightTarget, 1.0f) && !bForce) return;
+	//Keep adapting while an async hull result is pending
+	if (_LastSightTarget.Equals(_SightTarget, 1.0f) && !bForce && !_PendingHullWidth.IsValid()) return;
 
 	//Init work var
 	FVector MuzzleLoc = GetMuzzlePosition();
@@ -585,6 +582,9 @@ void UPS_WeaponComponent::AdaptSightMeshBound(const bool& bForce)
 		|| !IsValid(_SightHitResult.GetComponent())
 		|| (IsValid(_SightHitResult.GetComponent()) && !IsValid(procComp) && !IsValid(chaosComp)))
 	{
+		//No hull needed, drop pending request
+		ResetPendingHullWidth();
+
 		//Override scale 
 		SightMesh->SetWorldScale3D(DefaultAdaptationScale);
 
@@ -606,6 +606,8 @@ void UPS_WeaponComponent::AdaptSightMeshBound(const bool& bForce)
 	//--Chaos adaptation--
 	if(IsValid(chaosComp))
 	{
+		ResetPendingHullWidth();
+
 		FRotator rot = FRotator::ZeroRotator;
 		rot.Roll = SightMesh->GetRelativeRotation().Roll;
 		SightMesh->SetRelativeRotation(rot);
@@ -627,15 +629,11 @@ void UPS_WeaponComponent::AdaptSightMeshBound(const bool& bForce)
 void UPS_WeaponComponent::AdaptToProjectedHull(const FVector& MuzzleLoc, const FVector& ViewDir, UMeshComponent* meshComp)
 {
 	//Calcul du hull
-	FHullWidthOutData OutDatas = FHullWidthOutData();
-	double Width = UPSFL_GeometryScript::ComputeProjectedHullWidth(
-		meshComp,
-		ViewDir,
-		_SightTarget,
-		OutDatas,
-		bDebugRackBoundAdaptation
-	);
-	Width *= ProjectedAdaptationWeigth.X;
+	FPSHullWidthResult hullResult;
+	if (!GetProjectedHullWidth(ViewDir, meshComp, hullResult)) return;
+	
+	const FHullWidthOutData& OutDatas = hullResult.Datas;
+	double Width = hullResult.Width * ProjectedAdaptationWeigth.X;
 
 	// Project muzzle and center into same 2D frame
 	float Length = FVector::Distance(MuzzleLoc, _SightTarget);
@@ -709,6 +707,51 @@ void UPS_WeaponComponent::AdaptToProjectedHull(const FVector& MuzzleLoc, const F
 	SightMesh->SetRelativeRotation(DeltaRot);
 }
 
+void UPS_WeaponComponent::ResetPendingHullWidth()
+{
+	_PendingHullWidth.Reset();
+	_PendingHullWidthComponent.Reset();
+	_HullRequestComponent.Reset();
+}
+
+bool UPS_WeaponComponent::GetProjectedHullWidth(const FVector& ViewDir, UMeshComponent* meshComp, FPSHullWidthResult& outResult)
+{
+	UPS_GeometryQuerySubsystem* geometryQuerySubsystem = IsValid(GetWorld()) ? GetWorld()->GetSubsystem<UPS_GeometryQuerySubsystem>() : nullptr;
+
+	//Sync path, needed for hull debug draw
+	if (!bAsyncHullAdaptation || bDebugRackBoundAdaptation || !IsValid(geometryQuerySubsystem))
+	{
+		outResult.Width = UPSFL_GeometryScript::ComputeProjectedHullWidth(meshComp, ViewDir, _SightTarget, outResult.Datas, bDebugRackBoundAdaptation);
+		return true;
+	}
+
+	//Consume finished request
+	if (_PendingHullWidth.IsValid() && _PendingHullWidth.IsReady())
+	{
+		_LastHullWidth = _PendingHullWidth.Get();
+		_LastHullWidthComponent = _PendingHullWidthComponent;
+		_PendingHullWidth.Reset();
+	}
+
+	//Request new result only if sight changed since the last request, the last result is used meanwhile
+	const bool bHullInputsChanged = _HullRequestComponent != meshComp
+		|| !_HullRequestSightTarget.Equals(_SightTarget, 1.0f)
+		|| !_HullRequestViewDir.Equals(ViewDir, KINDA_SMALL_NUMBER);
+	if (!_PendingHullWidth.IsValid() && bHullInputsChanged)
+	{
+		_PendingHullWidth = geometryQuerySubsystem->RequestHullWidth(meshComp, ViewDir, _SightTarget);
+		_PendingHullWidthComponent = meshComp;
+		_HullRequestComponent = meshComp;
+		_HullRequestSightTarget = _SightTarget;
+		_HullRequestViewDir = ViewDir;
+	}
+
+	if (_LastHullWidthComponent != meshComp) return false;
+
+	outResult = _LastHullWidth;
+	return true;
+}
+
 //------------------
 #pragma endregion Adaptation
 
@@ -13,6 +13,7 @@
 
 #include "ProjectSlice/FunctionLibrary/PSFL_CustomProcMesh.h"
 #include "ProjectSlice/Interface/PS_CanGenerateImpactField.h"
+#include "ProjectSlice/System/PS_GeometryQuerySubsystem.h"
 
 #include "PS_WeaponComponent.generated.h"
 
@@ -398,6 +399,34 @@ protected:
 
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="Parameters|Sight|Adaptation")
 	FVector2D ProjectedAdaptationWeigth = FVector2D(1.0f, 1.0f);
+
+	//Compute hull width on a worker thread and use last result meanwhile (sync when debugging)
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="Parameters|Sight|Adaptation")
+	bool bAsyncHullAdaptation = true;
+
+private:
+	//Return false if no hull result is available yet for this mesh
+	bool GetProjectedHullWidth(const FVector& ViewDir, UMeshComponent* meshComp, FPSHullWidthResult& outResult);
+
+	void ResetPendingHullWidth();
+
+	TFuture<FPSHullWidthResult> _PendingHullWidth;
+
+	UPROPERTY(Transient)
+	TWeakObjectPtr<UMeshComponent> _PendingHullWidthComponent;
+
+	// Inputs of the last request, a new one is only sent when they change
+	FVector _HullRequestSightTarget = FVector::ZeroVector;
+
+	FVector _HullRequestViewDir = FVector::ZeroVector;
+
+	UPROPERTY(Transient)
+	TWeakObjectPtr<UMeshComponent> _HullRequestComponent;
+
+	FPSHullWidthResult _LastHullWidth;
+
+	UPROPERTY(Transient)
+	TWeakObjectPtr<UMeshComponent> _LastHullWidthComponent;
 	
 #pragma endregion Adaptation
 
@@ -0,0 +1,74 @@
+#include "PSFL_CurveLUT.h"
+
+void FPSCurveLUTStore::Init(const int32 curveCount)
+{
+	Reset();
+
+	_Samples.SetNumUninitialized(curveCount * SampleCount);
+	_Curves.SetNum(curveCount);
+#if WITH_EDITOR
+	_CurveUpdatedHandles.SetNum(curveCount);
+#endif
+
+	for (int32 slot = 0; slot < curveCount; ++slot)
+	{
+		SampleCurve(slot);
+	}
+}
+
+void FPSCurveLUTStore::Bake(const int32 slot, UCurveFloat* curve)
+{
+	if (!_Curves.IsValidIndex(slot) || _Curves[slot].Get() == curve) return;
+
+#if WITH_EDITOR
+	UnbindCurve(slot);
+	if (IsValid(curve)) _CurveUpdatedHandles[slot] = curve->OnUpdateCurve.AddRaw(this, &FPSCurveLUTStore::OnCurveUpdated, slot);
+#endif
+
+	_Curves[slot] = curve;
+	SampleCurve(slot);
+}
+
+void FPSCurveLUTStore::Reset()
+{
+#if WITH_EDITOR
+	for (int32 slot = 0; slot < _CurveUpdatedHandles.Num(); ++slot)
+	{
+		UnbindCurve(slot);
+	}
+	_CurveUpdatedHandles.Reset();
+#endif
+
+	_Samples.Reset();
+	_Curves.Reset();
+}
+
+void FPSCurveLUTStore::SampleCurve(const int32 slot)
+{
+	float* samples = _Samples.GetData() + slot * SampleCount;
+	const UCurveFloat* curve = _Curves[slot].Get();
+
+	for (int32 index = 0; index < SampleCount; ++index)
+	{
+		const float time = static_cast<float>(index) / (SampleCount - 1);
+		samples[index] = IsValid(curve) ? curve->GetFloatValue(time) : time;
+	}
+}
+
+#if WITH_EDITOR
+void FPSCurveLUTStore::OnCurveUpdated(UCurveBase* curve, EPropertyChangeType::Type changeType, const int32 slot)
+{
+	if (_Curves.IsValidIndex(slot) && _Curves[slot].Get() == curve) SampleCurve(slot);
+}
+
+void FPSCurveLUTStore::UnbindCurve(const int32 slot)
+{
+	if (!_CurveUpdatedHandles.IsValidIndex(slot) || !_CurveUpdatedHandles[slot].IsValid()) return;
+
+	if (UCurveFloat* curve = _Curves.IsValidIndex(slot) ? _Curves[slot].Get() : nullptr)
+	{
+		curve->OnUpdateCurve.Remove(_CurveUpdatedHandles[slot]);
+	}
+	_CurveUpdatedHandles[slot].Reset();
+}
+#endif
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Curves/CurveFloat.h"
+
+/**
+ * Float curves baked on [0, 1] into fixed size lookup tables, every table of a store packed in one aligned buffer.
+ * Evaluation is a clamped lerp between two samples, a missing curve is baked as identity so callers don't branch on it.
+ * In editor, tables are rebaked when their curve asset is edited.
+ */
+struct PROJECTSLICE_API FPSCurveLUTStore
+{
+	// 32 floats, two cache lines per curve
+	static constexpr int32 SampleCount = 32;
+
+	FPSCurveLUTStore() = default;
+
+	~FPSCurveLUTStore() { Reset(); }
+
+	UE_NONCOPYABLE(FPSCurveLUTStore);
+
+	// Allocate curveCount identity tables
+	void Init(const int32 curveCount);
+
+	// Sample curve into slot table, identity if curve is null. Rebaking the same curve does nothing
+	void Bake(const int32 slot, UCurveFloat* curve);
+
+	void Reset();
+
+	FORCEINLINE float Evaluate(const int32 slot, const float alpha) const
+	{
+		check(_Samples.IsValidIndex(slot * SampleCount + SampleCount - 1));
+
+		const float* samples = _Samples.GetData() + slot * SampleCount;
+		const float x = FMath::Clamp(alpha, 0.0f, 1.0f) * (SampleCount - 1);
+		const int32 index = FMath::Min(static_cast<int32>(x), SampleCount - 2);
+
+		return FMath::Lerp(samples[index], samples[index + 1], x - index);
+	}
+
+	FORCEINLINE int32 Num() const { return _Curves.Num(); }
+
+private:
+	void SampleCurve(const int32 slot);
+
+#if WITH_EDITOR
+	void OnCurveUpdated(UCurveBase* curve, EPropertyChangeType::Type changeType, const int32 slot);
+
+	void UnbindCurve(const int32 slot);
+
+	TArray<FDelegateHandle> _CurveUpdatedHandles;
+#endif
+
+	TArray<float, TAlignedHeapAllocator<PLATFORM_CACHE_LINE_SIZE>> _Samples;
+
+	TArray<TWeakObjectPtr<UCurveFloat>> _Curves;
+};
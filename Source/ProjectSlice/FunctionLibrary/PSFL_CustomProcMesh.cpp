@@ -658,6 +658,12 @@ void UPSFL_CustomProcMesh::SliceProcMesh(UProceduralMeshComponent* InProcMesh, F
 		// Update collision of proc mesh
 		InProcMesh->SetCollisionConvexMeshes(SlicedCollision);
 
+		// Geometry changed, cached hull must be rebuilt
+		if (UPS_SlicedComponent* SlicedProcMesh = Cast<UPS_SlicedComponent>(InProcMesh))
+		{
+			SlicedProcMesh->MarkGeometryDirty();
+		}
+
 		// If creating other half, create component now
 		if (bCreateOtherHalf)
 		{
@@ -7,11 +7,15 @@
 #include "Components/BaseDynamicMeshSceneProxy.h"
 #include "DynamicMesh/DynamicMeshAABBTree3.h"
 #include "Parameterization/MeshDijkstra.h"
+#include "Distance/DistPoint3Triangle3.h"
+#include "Generators/SphereGenerator.h"
 
 //Hull
 #include "CompGeom/ConvexHull2.h"
+#include "CompGeom/ConvexHull3.h"
 #include "Algo/Reverse.h"
 #include "Kismet/KismetMathLibrary.h"
+#include "ProjectSlice/Components/GPE/PS_SlicedComponent.h"
 
 using namespace UE::Geometry;
 
@@ -21,13 +25,17 @@ class UProceduralMeshComponent;
 //------------------
 
 
-bool UPSFL_GeometryScript::ProjectPointToMeshSurface(const FDynamicMesh3& Mesh, const FDynamicMeshAABBTree3& Spatial, 
+bool UPSFL_GeometryScript::ProjectPointToMeshSurface(const FDynamicMesh3& Mesh, const FPSMeshSpatialIndex& Spatial, 
 	const FVector3d& Point, FVector3d& OutProjectedPoint, int32& OutTriangleID)
 {
 	if(_bDebug) UE_LOG(LogTemp, Log, TEXT("ProjectPointToMeshSurface - Input Point: %s"), *Point.ToString());
     
-	// Utiliser uniquement la recherche brute force pour éviter les problèmes d'arbre spatial
-	OutTriangleID = FindNearestTriangleBruteForce(Mesh, Point);
+	// Requête sur l'AABB tree, brute force seulement si l'arbre ne trouve rien
+	OutTriangleID = Spatial.IsBuilt() ? Spatial.FindNearestTriangle(Point) : FDynamicMesh3::InvalidID;
+	if (OutTriangleID == FDynamicMesh3::InvalidID)
+	{
+		OutTriangleID = FindNearestTriangleBruteForce(Mesh, Point);
+	}
     
 	if (OutTriangleID == FDynamicMesh3::InvalidID)
 	{
@@ -57,10 +65,11 @@ void UPSFL_GeometryScript::ComputeGeodesicPath(UMeshComponent* meshComp, const F
 	}
 
 	// Créer la clé de cache
-	FPathCacheKey CacheKey(startPoint, endPoint, meshComp);
+	const FPathCacheKey CacheKey = MakePathCacheKey(startPoint, endPoint, meshComp);
+	const uint32 MeshRevision = GetMeshRevision(meshComp);
 
 	// Vérifier si le résultat existe déjà dans le cache
-	if (TryGetCachedPath(CacheKey, outPoints))
+	if (TryGetCachedPath(CacheKey, MeshRevision, outPoints))
 	{
 		if (bDebug)
 		{
@@ -69,25 +78,32 @@ void UPSFL_GeometryScript::ComputeGeodesicPath(UMeshComponent* meshComp, const F
 		return;
 	}
 
+	// Init var
+	outPoints.Reset();
+	_bDebug = bDebug;
+
+	// Convertir le mesh en DynamicMesh3
+	FDynamicMesh3 Mesh;
+	if (!ConvertMeshComponentToDynamicMesh(meshComp, Mesh))
+	{
+		if(_bDebug) UE_LOG(LogTemp, Warning, TEXT("ComputeGeodesicPath - Failed to convert mesh"));
+		return;
+	}
+
 	// Si pas dans le cache, calculer le path normalement
-	TArray<FVector> CalculatedPoints;
+	if (!ComputeGeodesicPath(Mesh, meshComp->GetComponentTransform(), startPoint, endPoint, outPoints, bDebug, bDebugPoint ? meshComp->GetWorld() : nullptr)) return;
 
+	//Stockage en cache du résultat
+	StoreCachedPath(CacheKey, MeshRevision, outPoints);
+}
+
+bool UPSFL_GeometryScript::ComputeGeodesicPath(const FDynamicMesh3& Mesh, const FTransform& ComponentTransform, const FVector& startPoint, const FVector& endPoint, TArray<FVector>& outPoints, const bool bDebug, const UWorld* DebugPointWorld, const FPSMeshSpatialIndex* SpatialIndex)
+{
 	// Init var
     outPoints.Reset();
 
 	_bDebug = bDebug;
-	_bDebugPoint = bDebugPoint;
-	
-    // Convertir le mesh en DynamicMesh3
-    FDynamicMesh3 Mesh;
-    if (!ConvertMeshComponentToDynamicMesh(meshComp, Mesh))
-    {
-        if(_bDebug) UE_LOG(LogTemp, Warning, TEXT("ComputeGeodesicPath - Failed to convert mesh"));
-        return;
-    }
-    
-    // Obtenir le transform du composant
-    FTransform ComponentTransform = meshComp->GetComponentTransform();
+	_DebugPointWorld = DebugPointWorld;
     
     if(_bDebug) UE_LOG(LogTemp, Log, TEXT("DynamicMesh - Vertices: %d, Triangles: %d"), 
            Mesh.VertexCount(), Mesh.TriangleCount());
@@ -102,8 +118,14 @@ void UPSFL_GeometryScript::ComputeGeodesicPath(UMeshComponent* meshComp, const F
     if(_bDebug) UE_LOG(LogTemp, Log, TEXT("LocalStart: %s, LocalEnd: %s"), 
            *LocalStart.ToString(), *LocalEnd.ToString());
     
-    // Créer l'arbre spatial
-    FDynamicMeshAABBTree3 Spatial(&Mesh);
+    // Index spatial du snapshot, sinon construit localement
+    FPSMeshSpatialIndex LocalSpatial;
+    if (!SpatialIndex)
+    {
+        LocalSpatial.Build(Mesh);
+        SpatialIndex = &LocalSpatial;
+    }
+    const FPSMeshSpatialIndex& Spatial = *SpatialIndex;
     
     // Projeter les points sur la surface
     FVector3d ProjectedStart, ProjectedEnd;
@@ -113,7 +135,7 @@ void UPSFL_GeometryScript::ComputeGeodesicPath(UMeshComponent* meshComp, const F
         !ProjectPointToMeshSurface(Mesh, Spatial, LocalEnd, ProjectedEnd, EndTriangleID))
     {
         if(_bDebug) UE_LOG(LogTemp, Warning, TEXT("ComputeGeodesicPath - Failed to project points to mesh surface"));
-        return;
+        return false;
     }
     
     if(_bDebug) UE_LOG(LogTemp, Log, TEXT("ProjectedStart: %s, ProjectedEnd: %s"), 
@@ -138,11 +160,8 @@ void UPSFL_GeometryScript::ComputeGeodesicPath(UMeshComponent* meshComp, const F
         }
         
         if(_bDebug) UE_LOG(LogTemp, Log, TEXT("ComputeGeodesicPath - Created direct path with %d points"), outPoints.Num());
-
-    	//Stockage en cache du résultat
-    	StoreCachedPath(CacheKey, outPoints);
     	
-        return;
+        return true;
     }
     
     // Obtenir les triangles et leurs vertices
@@ -195,7 +214,7 @@ void UPSFL_GeometryScript::ComputeGeodesicPath(UMeshComponent* meshComp, const F
             }
             else
             {
-                bPathFound = FindPathBetweenComponents(Mesh, StartCandidate, EndCandidate, CurrentPath);
+                bPathFound = FindPathBetweenComponents(Mesh, StartCandidate, EndCandidate, CurrentPath, SpatialIndex);
             }
             
             if (bPathFound && CurrentPath.Num() > 0)
@@ -229,17 +248,14 @@ void UPSFL_GeometryScript::ComputeGeodesicPath(UMeshComponent* meshComp, const F
         	
             outPoints.Add(WorldPos);
 
-        	if (_bDebugPoint && meshComp->GetWorld()) DrawDebugPoint(meshComp->GetWorld(), WorldPos, 10.f + (i * 5), FColor::Magenta, true, 0.5f, 20.0f);
+        	if (_DebugPointWorld) DrawDebugPoint(_DebugPointWorld, WorldPos, 10.f + (i * 5), FColor::Magenta, true, 0.5f, 20.0f);
 
         	i++;
         }
         
     	if(_bDebug) UE_LOG(LogTemp, Log, TEXT("ComputeGeodesicPath - SUCCESS! Found path with %d points, length %f"), outPoints.Num(), BestPathLength);
-
-    	//Stockage en cache du résultat
-    	StoreCachedPath(CacheKey, outPoints);
     	
-        return;
+        return true;
     }
     
     // Fallback: ligne droite
@@ -254,14 +270,11 @@ void UPSFL_GeometryScript::ComputeGeodesicPath(UMeshComponent* meshComp, const F
         FVector IntermediatePoint = FMath::Lerp(startPoint, endPoint, alpha);
         outPoints.Add(IntermediatePoint);
 
-    	if (_bDebugPoint && meshComp->GetWorld()) DrawDebugPoint(meshComp->GetWorld(), IntermediatePoint, 10.f, FColor::Magenta, true, 0.5f, 20.0f);
+    	if (_DebugPointWorld) DrawDebugPoint(_DebugPointWorld, IntermediatePoint, 10.f, FColor::Magenta, true, 0.5f, 20.0f);
     }
     outPoints.Add(endPoint);
-    
-     //Stockage en cache du résultat
-     StoreCachedPath(CacheKey, outPoints);
-	
-	
+
+	return true;
 }
 
 void UPSFL_GeometryScript::ComputeGeodesicPathWithVelocity(UMeshComponent* meshComp, const FVector& startPoint, const FVector& endPoint, const FVector& velocity, TArray<FVector>& outPoints, float velocityInfluence, const bool bDebug, const bool bDebugPoint)
@@ -279,21 +292,9 @@ void UPSFL_GeometryScript::ComputeGeodesicPathWithVelocity(UMeshComponent* meshC
 		return;
 	}
 
-    // Normaliser la vélocité si elle n'est pas nulle
-    FVector3d normalizedVelocity = velocity;
-    if (normalizedVelocity.Length() > SMALL_NUMBER)
-    {
-        normalizedVelocity.Normalize();
-    }
-
-    // Créer une clé de cache modifiée pour inclure la vélocité
-    FPathCacheKey CacheKey(startPoint, endPoint, meshComp);
-    // Note: vous pourriez vouloir modifier FPathCacheKey pour inclure la vélocité
-
     // Initialiser les variables
     outPoints.Reset();
     _bDebug = bDebug;
-    _bDebugPoint = bDebugPoint;
 
     // Convertir le mesh en DynamicMesh3
     FDynamicMesh3 Mesh;
@@ -303,16 +304,41 @@ void UPSFL_GeometryScript::ComputeGeodesicPathWithVelocity(UMeshComponent* meshC
         return;
     }
 
-    // Obtenir le transform du composant
-    FTransform ComponentTransform = meshComp->GetComponentTransform();
+	ComputeGeodesicPathWithVelocity(Mesh, meshComp->GetComponentTransform(), startPoint, endPoint, velocity, outPoints, velocityInfluence, bDebug, bDebugPoint ? meshComp->GetWorld() : nullptr);
+}
+
+bool UPSFL_GeometryScript::ComputeGeodesicPathWithVelocity(const FDynamicMesh3& Mesh, const FTransform& ComponentTransform, const FVector& startPoint, const FVector& endPoint, const FVector& velocity, TArray<FVector>& outPoints, float velocityInfluence, const bool bDebug, const UWorld* DebugPointWorld, const FPSMeshSpatialIndex* SpatialIndex)
+{
+	if (velocity.IsNearlyZero())
+	{
+		return ComputeGeodesicPath(Mesh, ComponentTransform, startPoint, endPoint, outPoints, bDebug, DebugPointWorld, SpatialIndex);
+	}
+
+    // Normaliser la vélocité si elle n'est pas nulle
+    FVector3d normalizedVelocity = velocity;
+    if (normalizedVelocity.Length() > SMALL_NUMBER)
+    {
+        normalizedVelocity.Normalize();
+    }
+
+    // Initialiser les variables
+    outPoints.Reset();
+    _bDebug = bDebug;
+	_DebugPointWorld = DebugPointWorld;
 
     // Transformer les points et la vélocité en coordonnées locales
     FVector3d LocalStart = ComponentTransform.InverseTransformPosition(startPoint);
     FVector3d LocalEnd = ComponentTransform.InverseTransformPosition(endPoint);
     FVector3d LocalVelocity = ComponentTransform.InverseTransformVector(normalizedVelocity);
 
-    // Créer l'arbre spatial
-    FDynamicMeshAABBTree3 Spatial(&Mesh);
+    // Index spatial du snapshot, sinon construit localement
+    FPSMeshSpatialIndex LocalSpatial;
+    if (!SpatialIndex)
+    {
+        LocalSpatial.Build(Mesh);
+        SpatialIndex = &LocalSpatial;
+    }
+    const FPSMeshSpatialIndex& Spatial = *SpatialIndex;
 
     // Projeter les points sur la surface
     FVector3d ProjectedStart, ProjectedEnd;
@@ -322,17 +348,17 @@ void UPSFL_GeometryScript::ComputeGeodesicPathWithVelocity(UMeshComponent* meshC
         !ProjectPointToMeshSurface(Mesh, Spatial, LocalEnd, ProjectedEnd, EndTriangleID))
     {
         if (_bDebug) UE_LOG(LogTemp, Warning, TEXT("ComputeGeodesicPathWithVelocity - Failed to project points to mesh surface"));
-        return;
+        return false;
     }
 
     // Trouver les vertices les plus proches
-    int32 StartVertexID = FindNearestVertex(Mesh, ProjectedStart);
-    int32 EndVertexID = FindNearestVertex(Mesh, ProjectedEnd);
+    int32 StartVertexID = FindNearestVertex(Mesh, ProjectedStart, SpatialIndex);
+    int32 EndVertexID = FindNearestVertex(Mesh, ProjectedEnd, SpatialIndex);
 
     if (StartVertexID == FDynamicMesh3::InvalidID || EndVertexID == FDynamicMesh3::InvalidID)
     {
         if (_bDebug) UE_LOG(LogTemp, Warning, TEXT("ComputeGeodesicPathWithVelocity - Failed to find nearest vertices"));
-        return;
+        return false;
     }
 
     // Utiliser l'algorithme de Dijkstra modifié avec vélocité
@@ -364,13 +390,67 @@ void UPSFL_GeometryScript::ComputeGeodesicPathWithVelocity(UMeshComponent* meshC
         {
             UE_LOG(LogTemp, Log, TEXT("ComputeGeodesicPathWithVelocity - Path found with %d points"), outPoints.Num());
         }
+    	return true;
     }
-    else
-    {
-        // Fallback vers la méthode standard
-        if (_bDebug) UE_LOG(LogTemp, Warning, TEXT("ComputeGeodesicPathWithVelocity - Falling back to standard geodesic path"));
-        ComputeGeodesicPath(meshComp, startPoint, endPoint, outPoints, bDebug, bDebugPoint);
-    }
+
+	// Fallback vers la méthode standard
+	if (_bDebug) UE_LOG(LogTemp, Warning, TEXT("ComputeGeodesicPathWithVelocity - Falling back to standard geodesic path"));
+	return ComputeGeodesicPath(Mesh, ComponentTransform, startPoint, endPoint, outPoints, bDebug, DebugPointWorld, SpatialIndex);
+}
+
+bool UPSFL_GeometryScript::FindNearestPointOnMesh(const FDynamicMesh3& Mesh, const FTransform& ComponentTransform, const FVector& Point, FVector& OutPoint, const bool bDebug, const FPSMeshSpatialIndex* SpatialIndex)
+{
+	_bDebug = bDebug;
+
+	FPSMeshSpatialIndex LocalSpatial;
+	if (!SpatialIndex)
+	{
+		LocalSpatial.Build(Mesh);
+		SpatialIndex = &LocalSpatial;
+	}
+
+	FVector3d ProjectedPoint;
+	int32 TriangleID;
+	if (!ProjectPointToMeshSurface(Mesh, *SpatialIndex, ComponentTransform.InverseTransformPosition(Point), ProjectedPoint, TriangleID)) return false;
+
+	OutPoint = ComponentTransform.TransformPosition(ProjectedPoint);
+	return true;
+}
+
+bool UPSFL_GeometryScript::ProjectPointsToMeshSurface(const FDynamicMesh3& Mesh, const FTransform& ComponentTransform, const TArray<FVector>& Points, TArray<FVector>& OutPoints, const FPSMeshSpatialIndex* SpatialIndex)
+{
+	OutPoints.Reset();
+	if (Points.IsEmpty()) return true;
+
+	FPSMeshSpatialIndex LocalSpatial;
+	if (!SpatialIndex)
+	{
+		LocalSpatial.Build(Mesh);
+		SpatialIndex = &LocalSpatial;
+	}
+
+	// Points en espace local
+	TArray<FVector3d> LocalPoints;
+	LocalPoints.Reserve(Points.Num());
+	for (const FVector& Point : Points)
+	{
+		LocalPoints.Add(ComponentTransform.InverseTransformPosition(Point));
+	}
+
+	TArray<int32> TriangleIDs;
+	SpatialIndex->FindNearestTriangles(LocalPoints, TriangleIDs);
+
+	OutPoints.Reserve(Points.Num());
+	for (int32 i = 0; i < LocalPoints.Num(); ++i)
+	{
+		int32 TriangleID = TriangleIDs[i];
+		if (TriangleID == FDynamicMesh3::InvalidID) TriangleID = FindNearestTriangleBruteForce(Mesh, LocalPoints[i]);
+		if (TriangleID == FDynamicMesh3::InvalidID) return false;
+
+		OutPoints.Add(ComponentTransform.TransformPosition(GetClosestPointOnTriangle(Mesh, TriangleID, LocalPoints[i])));
+	}
+
+	return true;
 }
 
 // Fonction helper pour vérifier la connectivité rapidement
@@ -608,7 +688,7 @@ void UPSFL_GeometryScript::AnalyzeMeshConnectivity(const FDynamicMesh3& Mesh)
 }
 
 // Fonction pour trouver le chemin entre deux composants différents
-bool UPSFL_GeometryScript::FindPathBetweenComponents(const FDynamicMesh3& Mesh, int32 StartVID, int32 EndVID, TArray<int32>& OutPath)
+bool UPSFL_GeometryScript::FindPathBetweenComponents(const FDynamicMesh3& Mesh, int32 StartVID, int32 EndVID, TArray<int32>& OutPath, const FPSMeshSpatialIndex* SpatialIndex)
 {
     // Trouver les composants de chaque vertex
     TArray<int32> StartComponent = GetVertexComponent(Mesh, StartVID);
@@ -657,7 +737,7 @@ bool UPSFL_GeometryScript::FindPathBetweenComponents(const FDynamicMesh3& Mesh,
     if (MinDistance < 0.001f)
     {
         if(_bDebug) UE_LOG(LogTemp, Warning, TEXT("Bridge vertices are identical, creating surface path"));
-        return CreateSurfacePath(Mesh, StartVID, EndVID, OutPath);
+        return CreateSurfacePath(Mesh, StartVID, EndVID, OutPath, SpatialIndex);
     }
     
     // Créer le chemin en trois parties
@@ -730,7 +810,7 @@ float UPSFL_GeometryScript::CalculatePathLength(const FDynamicMesh3& Mesh, const
 }
 
 // Nouvelle fonction pour créer un chemin sur la surface quand les composants se touchent
-bool UPSFL_GeometryScript::CreateSurfacePath(const FDynamicMesh3& Mesh, int32 StartVID, int32 EndVID, TArray<int32>& OutPath)
+bool UPSFL_GeometryScript::CreateSurfacePath(const FDynamicMesh3& Mesh, int32 StartVID, int32 EndVID, TArray<int32>& OutPath, const FPSMeshSpatialIndex* SpatialIndex)
 {
 	OutPath.Reset();
     
@@ -750,7 +830,7 @@ bool UPSFL_GeometryScript::CreateSurfacePath(const FDynamicMesh3& Mesh, int32 St
 		FVector3d IntermediatePos = FMath::Lerp(StartPos, EndPos, Alpha);
         
 		// Trouver le vertex le plus proche de cette position intermédiaire
-		int32 ClosestVID = FindNearestVertex(const_cast<FDynamicMesh3&>(Mesh), IntermediatePos);
+		int32 ClosestVID = FindNearestVertex(Mesh, IntermediatePos, SpatialIndex);
 		if (ClosestVID != FDynamicMesh3::InvalidID && !OutPath.Contains(ClosestVID))
 		{
 			OutPath.Add(ClosestVID);
@@ -769,113 +849,337 @@ bool UPSFL_GeometryScript::CreateSurfacePath(const FDynamicMesh3& Mesh, int32 St
 #pragma region Cache
 //------------------
 
+#pragma region LruCache
+//------------------
+
+bool FPathLruCache::Find(const FPathCacheKey& Key, const uint32 MeshRevision, const double CurrentTime, const double ExpirationTime, TArray<FVector>& OutPoints)
+{
+	const int32* IndexPtr = KeyToEntry.Find(Key);
+	if (!IndexPtr)
+	{
+		++Misses;
+		return false;
+	}
+
+	// Le mesh a été modifié depuis : tout son bucket est obsolète
+	const FPathCacheMeshBucket* Bucket = MeshBuckets.Find(Key.MeshComponent);
+	if (!Bucket || Bucket->MeshRevision != MeshRevision)
+	{
+		InvalidateMesh(Key.MeshComponent);
+		++Misses;
+		return false;
+	}
+
+	const int32 Index = *IndexPtr;
+	FPathCacheEntry& Entry = Entries[Index];
+
+	// Expiration vérifiée uniquement sur l'entrée consultée
+	if (CurrentTime - Entry.LastAccessTime >= ExpirationTime)
+	{
+		RemoveEntry(Index);
+		++Misses;
+		return false;
+	}
+
+	Entry.LastAccessTime = CurrentTime;
+	OutPoints = Entry.Points;
+
+	// Remonte en tête de liste LRU
+	UnlinkLru(Index);
+	LinkFront(Index);
+
+	++Hits;
+	return true;
+}
+
+void FPathLruCache::Store(const FPathCacheKey& Key, const uint32 MeshRevision, const TArray<FVector>& Points, const double CurrentTime, const double ExpirationTime)
+{
+	// Purge le bucket si le mesh a changé de révision
+	if (const FPathCacheMeshBucket* Bucket = MeshBuckets.Find(Key.MeshComponent))
+	{
+		if (Bucket->MeshRevision != MeshRevision) InvalidateMesh(Key.MeshComponent);
+	}
+
+	// Mise à jour d'une entrée existante
+	if (const int32* IndexPtr = KeyToEntry.Find(Key))
+	{
+		const int32 Index = *IndexPtr;
+		Entries[Index].Points = Points;
+		Entries[Index].LastAccessTime = CurrentTime;
+		UnlinkLru(Index);
+		LinkFront(Index);
+		return;
+	}
+
+	// Les entrées expirées sont forcément en queue de liste
+	while (Tail != INDEX_NONE && CurrentTime - Entries[Tail].LastAccessTime >= ExpirationTime)
+	{
+		RemoveEntry(Tail);
+	}
+
+	// Cache plein : on évince la moins récemment utilisée
+	while (Tail != INDEX_NONE && KeyToEntry.Num() >= MaxSize)
+	{
+		RemoveEntry(Tail);
+		++Evictions;
+	}
+
+	const int32 Index = FreeIndices.Num() > 0 ? FreeIndices.Pop(EAllowShrinking::No) : Entries.AddDefaulted();
+	FPathCacheEntry& Entry = Entries[Index];
+	Entry.Key = Key;
+	Entry.Points = Points;
+	Entry.LastAccessTime = CurrentTime;
+
+	LinkFront(Index);
+
+	// Chaîne l'entrée dans le bucket de son mesh
+	FPathCacheMeshBucket& Bucket = MeshBuckets.FindOrAdd(Key.MeshComponent);
+	Bucket.MeshRevision = MeshRevision;
+	Entry.BucketPrev = INDEX_NONE;
+	Entry.BucketNext = Bucket.Head;
+	if (Bucket.Head != INDEX_NONE) Entries[Bucket.Head].BucketPrev = Index;
+	Bucket.Head = Index;
+	Bucket.Num++;
+
+	KeyToEntry.Add(Key, Index);
+}
+
+void FPathLruCache::SetMaxSize(const int32 InMaxSize)
+{
+	MaxSize = FMath::Max(1, InMaxSize);
+
+	// Si le cache actuel est plus grand que la nouvelle limite, le réduire
+	while (Tail != INDEX_NONE && KeyToEntry.Num() > MaxSize)
+	{
+		RemoveEntry(Tail);
+		++Evictions;
+	}
+}
+
+void FPathLruCache::Empty()
+{
+	Entries.Empty();
+	FreeIndices.Empty();
+	KeyToEntry.Empty();
+	MeshBuckets.Empty();
+	Head = Tail = INDEX_NONE;
+	Hits = Misses = Evictions = 0;
+}
+
+void FPathLruCache::LinkFront(const int32 Index)
+{
+	FPathCacheEntry& Entry = Entries[Index];
+	Entry.LruPrev = INDEX_NONE;
+	Entry.LruNext = Head;
+	
+	if (Head != INDEX_NONE) Entries[Head].LruPrev = Index;
+	Head = Index;
+	
+	if (Tail == INDEX_NONE) Tail = Index;
+}
+
+void FPathLruCache::UnlinkLru(const int32 Index)
+{
+	FPathCacheEntry& Entry = Entries[Index];
+	
+	if (Entry.LruPrev != INDEX_NONE) Entries[Entry.LruPrev].LruNext = Entry.LruNext;
+	else Head = Entry.LruNext;
+	
+	if (Entry.LruNext != INDEX_NONE) Entries[Entry.LruNext].LruPrev = Entry.LruPrev;
+	else Tail = Entry.LruPrev;
+	
+	Entry.LruPrev = Entry.LruNext = INDEX_NONE;
+}
+
+void FPathLruCache::RemoveEntry(const int32 Index)
+{
+	FPathCacheEntry& Entry = Entries[Index];
+
+	UnlinkLru(Index);
+
+	// Retire l'entrée de son bucket, le bucket vide est supprimé
+	if (FPathCacheMeshBucket* Bucket = MeshBuckets.Find(Entry.Key.MeshComponent))
+	{
+		if (Entry.BucketPrev != INDEX_NONE) Entries[Entry.BucketPrev].BucketNext = Entry.BucketNext;
+		else Bucket->Head = Entry.BucketNext;
+		
+		if (Entry.BucketNext != INDEX_NONE) Entries[Entry.BucketNext].BucketPrev = Entry.BucketPrev;
+
+		if (--Bucket->Num <= 0) MeshBuckets.Remove(Entry.Key.MeshComponent);
+	}
+
+	KeyToEntry.Remove(Entry.Key);
+
+	Entry.Key = FPathCacheKey();
+	Entry.Points.Empty();
+	Entry.BucketPrev = Entry.BucketNext = INDEX_NONE;
+	FreeIndices.Push(Index);
+}
+
+void FPathLruCache::InvalidateMesh(const TWeakObjectPtr<UMeshComponent>& MeshComponent)
+{
+	const FPathCacheMeshBucket* Bucket = MeshBuckets.Find(MeshComponent);
+	if (!Bucket) return;
+
+	// Copie de la clé, le bucket est supprimé avec sa dernière entrée
+	const TWeakObjectPtr<UMeshComponent> MeshKey = MeshComponent;
+	int32 Index = Bucket->Head;
+	while (Index != INDEX_NONE)
+	{
+		const int32 Next = Entries[Index].BucketNext;
+		RemoveEntry(Index);
+		Index = Next;
+	}
+	MeshBuckets.Remove(MeshKey);
+}
+
+//------------------
+#pragma endregion LruCache
+
 // Initialisation des variables statiques du cache
-TMap<FPathCacheKey, FPathCacheEntry> UPSFL_GeometryScript::PathCache;
-int32 UPSFL_GeometryScript::MaxCacheSize = 100;
+FPathLruCache UPSFL_GeometryScript::PathCache;
+float UPSFL_GeometryScript::CacheCellSize = 1.0f;
+FCriticalSection UPSFL_GeometryScript::PathCacheLock;
 
-bool UPSFL_GeometryScript::TryGetCachedPath(const FPathCacheKey& Key, TArray<FVector>& OutPoints)
+uint32 UPSFL_GeometryScript::GetMeshRevision(const UMeshComponent* MeshComponent)
 {
-    // Nettoyer le cache expiré périodiquement
-    CleanupExpiredCache();
-    
-    if (FPathCacheEntry* Entry = PathCache.Find(Key))
-    {
-        // Vérifier si l'entrée n'est pas expirée
-        double CurrentTime = FPlatformTime::Seconds();
-        if (CurrentTime - Entry->LastAccessTime < CacheExpirationTime)
-        {
-            Entry->LastAccessTime = CurrentTime; // Mettre à jour le temps d'accès
-            OutPoints = Entry->Points;
-            return true;
-        }
-        else
-        {
-            // L'entrée est expirée, la supprimer
-            PathCache.Remove(Key);
-        }
-    }
-    
-    return false;
+	if (const UPS_SlicedComponent* SlicedComponent = Cast<UPS_SlicedComponent>(MeshComponent))
+	{
+		return SlicedComponent->GetMeshRevision();
+	}
+	return 0;
 }
 
-void UPSFL_GeometryScript::StoreCachedPath(const FPathCacheKey& Key, const TArray<FVector>& Points)
+FPathCacheKey UPSFL_GeometryScript::MakePathCacheKey(const FVector& StartPoint, const FVector& EndPoint, const TWeakObjectPtr<UMeshComponent>& MeshComponent)
 {
-    // Vérifier si le cache est plein
-    if (PathCache.Num() >= MaxCacheSize)
-    {
-        // Supprimer l'entrée la plus ancienne
-        FPathCacheKey OldestKey = FPathCacheKey();
-        double OldestTime = FPlatformTime::Seconds();
-        
-        for (const auto& Pair : PathCache)
-        {
-            if (Pair.Value.LastAccessTime < OldestTime)
-            {
-                OldestTime = Pair.Value.LastAccessTime;
-                OldestKey = Pair.Key;
-            }
-        }
-        
-        PathCache.Remove(OldestKey);
-    }
-    
-    // Ajouter la nouvelle entrée
-    PathCache.Add(Key, FPathCacheEntry(Points));
+	FScopeLock Lock(&PathCacheLock);
+
+	return FPathCacheKey(StartPoint, EndPoint, MeshComponent, CacheCellSize);
 }
 
-void UPSFL_GeometryScript::CleanupExpiredCache()
+bool UPSFL_GeometryScript::TryGetCachedPath(const FPathCacheKey& Key, const uint32 MeshRevision, TArray<FVector>& OutPoints)
 {
-    double CurrentTime = FPlatformTime::Seconds();
-    
-    // Collecter les clés expirées
-    TArray<FPathCacheKey> ExpiredKeys;
-    for (const auto& Pair : PathCache)
-    {
-        if (CurrentTime - Pair.Value.LastAccessTime >= CacheExpirationTime)
-        {
-            ExpiredKeys.Add(Pair.Key);
-        }
-    }
-    
-    // Supprimer les entrées expirées
-    for (const FPathCacheKey& ExpiredKey : ExpiredKeys)
-    {
-        PathCache.Remove(ExpiredKey);
-    }
+	FScopeLock Lock(&PathCacheLock);
+	return PathCache.Find(Key, MeshRevision, FPlatformTime::Seconds(), CacheExpirationTime, OutPoints);
+}
+
+void UPSFL_GeometryScript::StoreCachedPath(const FPathCacheKey& Key, const uint32 MeshRevision, const TArray<FVector>& Points)
+{
+	FScopeLock Lock(&PathCacheLock);
+	PathCache.Store(Key, MeshRevision, Points, FPlatformTime::Seconds(), CacheExpirationTime);
 }
 
 void UPSFL_GeometryScript::ClearPathCache()
 {
+	FScopeLock Lock(&PathCacheLock);
+	
+	UE_LOG(LogTemp, Log, TEXT("Path cache cleared (hits %d, misses %d, evictions %d)"), PathCache.Hits, PathCache.Misses, PathCache.Evictions);
 	PathCache.Empty();
-	UE_LOG(LogTemp, Log, TEXT("Path cache cleared"));
 }
 
 void UPSFL_GeometryScript::SetMaxCacheSize(int32 MaxSize)
 {
-	MaxCacheSize = FMath::Max(1, MaxSize);
-    
-	// Si le cache actuel est plus grand que la nouvelle limite, le réduire
-	while (PathCache.Num() > MaxCacheSize)
+	FScopeLock Lock(&PathCacheLock);
+	PathCache.SetMaxSize(MaxSize);
+}
+
+void UPSFL_GeometryScript::SetCacheCellSize(float CellSize)
+{
+	FScopeLock Lock(&PathCacheLock);
+	
+	CacheCellSize = FMath::Max(MinCacheCellSize, CellSize);
+
+	// Les clés existantes ont été quantifiées avec l'ancienne taille
+	PathCache.Empty();
+}
+
+void UPSFL_GeometryScript::GetPathCacheStats(int32& OutHits, int32& OutMisses, int32& OutEvictions, int32& OutEntries)
+{
+	FScopeLock Lock(&PathCacheLock);
+	
+	OutHits = PathCache.Hits;
+	OutMisses = PathCache.Misses;
+	OutEvictions = PathCache.Evictions;
+	OutEntries = PathCache.Num();
+}
+
+//------------------
+#pragma endregion Cache
+
+#pragma region Spatial
+//------------------
+
+void FPSMeshSpatialIndex::Build(const FDynamicMesh3& InMesh)
+{
+	Mesh = &InMesh;
+	TriangleTree.SetMesh(Mesh, true);
+
+	// Taille de cellule ~ espacement moyen entre vertex
+	const FAxisAlignedBox3d Bounds = Mesh->GetBounds();
+	const double Diagonal = FMath::Max(Bounds.DiagonalLength(), UE_DOUBLE_KINDA_SMALL_NUMBER);
+	VertexCellSize = FMath::Max(Diagonal / FMath::Max(1.0, FMath::Pow(static_cast<double>(Mesh->VertexCount()), 1.0 / 3.0)), UE_DOUBLE_KINDA_SMALL_NUMBER);
+	VertexMaxSearchRadius = Diagonal;
+
+	VertexGrid = MakeUnique<TPointHashGrid3d<int32>>(VertexCellSize, FDynamicMesh3::InvalidID);
+	for (int32 VID : Mesh->VertexIndicesItr())
 	{
-		// Supprimer l'entrée la plus ancienne
-		FPathCacheKey OldestKey = FPathCacheKey();
-		double OldestTime = FPlatformTime::Seconds();
-        
-		for (const auto& Pair : PathCache)
+		VertexGrid->InsertPointUnsafe(VID, Mesh->GetVertex(VID));
+	}
+}
+
+int32 FPSMeshSpatialIndex::FindNearestTriangle(const FVector3d& Point, const double MaxDistance) const
+{
+	if (!IsBuilt()) return FDynamicMesh3::InvalidID;
+
+	double NearestDistSqr = TNumericLimits<double>::Max();
+	return TriangleTree.FindNearestTriangle(Point, NearestDistSqr, IMeshSpatial::FQueryOptions(MaxDistance));
+}
+
+void FPSMeshSpatialIndex::FindNearestTriangles(TConstArrayView<FVector3d> Points, TArray<int32>& OutTriangleIDs) const
+{
+	OutTriangleIDs.Init(FDynamicMesh3::InvalidID, Points.Num());
+	if (!IsBuilt()) return;
+
+	int32 PreviousTriangleID = FDynamicMesh3::InvalidID;
+	for (int32 i = 0; i < Points.Num(); ++i)
+	{
+		const FVector3d& Point = Points[i];
+
+		// La distance au triangle précédent majore la distance au plus proche : on élague tout ce qui est au-delà
+		double MaxDistance = TNumericLimits<double>::Max();
+		if (PreviousTriangleID != FDynamicMesh3::InvalidID)
 		{
-			if (Pair.Value.LastAccessTime < OldestTime)
-			{
-				OldestTime = Pair.Value.LastAccessTime;
-				OldestKey = Pair.Key;
-			}
+			FVector3d A, B, C;
+			Mesh->GetTriVertices(PreviousTriangleID, A, B, C);
+			FDistPoint3Triangle3d Distance(Point, FTriangle3d(A, B, C));
+			MaxDistance = FMath::Sqrt(Distance.GetSquared()) + UE_DOUBLE_KINDA_SMALL_NUMBER;
 		}
-        
-		PathCache.Remove(OldestKey);
+
+		int32 TriangleID = FindNearestTriangle(Point, MaxDistance);
+		if (TriangleID == FDynamicMesh3::InvalidID) TriangleID = PreviousTriangleID;
+
+		OutTriangleIDs[i] = TriangleID;
+		PreviousTriangleID = TriangleID;
+	}
+}
+
+int32 FPSMeshSpatialIndex::FindNearestVertex(const FVector3d& Point) const
+{
+	if (!IsBuilt() || !VertexGrid.IsValid()) return FDynamicMesh3::InvalidID;
+
+	auto DistanceSqr = [this, &Point](const int32& VID) { return FVector3d::DistSquared(Mesh->GetVertex(VID), Point); };
+
+	// Rayon doublé tant qu'aucun vertex n'est trouvé, le point peut être loin du mesh
+	for (double Radius = VertexCellSize; Radius <= VertexMaxSearchRadius * 2.0; Radius *= 2.0)
+	{
+		const TPair<int32, double> Nearest = VertexGrid->FindNearestInRadius(Point, Radius, DistanceSqr);
+		if (Nearest.Key != FDynamicMesh3::InvalidID) return Nearest.Key;
 	}
+	return FDynamicMesh3::InvalidID;
 }
 
 //------------------
-#pragma endregion Cache
+#pragma endregion Spatial
 
 #pragma region Triangle
 //------------------
@@ -1038,7 +1342,19 @@ int32 UPSFL_GeometryScript::FindNearestTriangleBruteForce(const FDynamicMesh3& M
     return NearestTriID;
 }
 
-int32 UPSFL_GeometryScript::FindNearestVertex(FDynamicMesh3& Mesh, const FVector3d& Point)
+int32 UPSFL_GeometryScript::FindNearestVertex(const FDynamicMesh3& Mesh, const FVector3d& Point, const FPSMeshSpatialIndex* SpatialIndex)
+{
+	if (SpatialIndex && SpatialIndex->IsBuilt())
+	{
+		const int32 NearestVID = SpatialIndex->FindNearestVertex(Point);
+		if(_bDebug) UE_LOG(LogTemp, Log, TEXT("FindNearestVertex - Grid result: vertex %d"), NearestVID);
+		if (NearestVID != FDynamicMesh3::InvalidID) return NearestVID;
+	}
+	
+	return FindNearestVertexBruteForce(Mesh, Point);
+}
+
+int32 UPSFL_GeometryScript::FindNearestVertexBruteForce(const FDynamicMesh3& Mesh, const FVector3d& Point)
 {
 	int32 NearestVID = FDynamicMesh3::InvalidID;
 	double MinDistance = TNumericLimits<double>::Max();
@@ -1694,6 +2010,108 @@ static void ComputeConvexHull2D(const TArray<FVector2d>& Points, TArray<int32>&
 	OutHullIndices = Hull;
 }
 
+// Diamètre d'un polygone convexe par rotating calipers (O(h) au lieu de O(h²))
+// Hull doit être ordonné (CCW), retourne la distance² max et les indices de la paire antipodale
+static double ComputeHullDiameterRotatingCalipers(const TArray<FVector2d>& Points, const TArray<int32>& Hull, int32& OutIndexA, int32& OutIndexB)
+{
+	OutIndexA = OutIndexB = -1;
+	const int32 HullNum = Hull.Num();
+	if (HullNum < 2) return 0.0;
+
+	auto Area2 = [&](int32 A, int32 B, int32 C)
+	{
+		const FVector2d& PA = Points[Hull[A]];
+		const FVector2d& PB = Points[Hull[B]];
+		const FVector2d& PC = Points[Hull[C]];
+		return FMath::Abs((PB.X - PA.X) * (PC.Y - PA.Y) - (PB.Y - PA.Y) * (PC.X - PA.X));
+	};
+
+	double MaxDistSq = 0.0;
+	auto TestPair = [&](int32 A, int32 B)
+	{
+		const double DistSq = FVector2d::DistSquared(Points[Hull[A]], Points[Hull[B]]);
+		if (DistSq > MaxDistSq)
+		{
+			MaxDistSq = DistSq;
+			OutIndexA = Hull[A];
+			OutIndexB = Hull[B];
+		}
+	};
+
+	if (HullNum == 2)
+	{
+		TestPair(0, 1);
+		return MaxDistSq;
+	}
+
+	// Pour chaque arête, on avance le point antipodal tant que l'aire (distance à l'arête) augmente
+	int32 j = 1;
+	for (int32 i = 0; i < HullNum; ++i)
+	{
+		const int32 NextI = (i + 1) % HullNum;
+		while (Area2(i, NextI, (j + 1) % HullNum) > Area2(i, NextI, j))
+		{
+			j = (j + 1) % HullNum;
+		}
+		TestPair(i, j);
+		TestPair(NextI, j);
+	}
+
+	return MaxDistSq;
+}
+
+bool UPSFL_GeometryScript::ComputeConvexHullPoints(UMeshComponent* MeshComponent, TArray<FVector>& OutLocalHullPoints)
+{
+	OutLocalHullPoints.Reset();
+
+	if (!IsValid(MeshComponent)) return false;
+
+	FDynamicMesh3 DynamicMesh;
+	if (!ConvertMeshComponentToDynamicMesh(MeshComponent, DynamicMesh)) return false;
+
+	return ComputeConvexHullPoints(DynamicMesh, OutLocalHullPoints);
+}
+
+bool UPSFL_GeometryScript::ComputeConvexHullPoints(const FDynamicMesh3& DynamicMesh, TArray<FVector>& OutLocalHullPoints)
+{
+	OutLocalHullPoints.Reset();
+
+	if (DynamicMesh.VertexCount() == 0) return false;
+
+	FConvexHull3d HullSolver;
+	const bool bSolved = HullSolver.Solve(DynamicMesh.MaxVertexID(),
+		[&DynamicMesh](int32 VID) { return DynamicMesh.GetVertex(VID); },
+		[&DynamicMesh](int32 VID) { return DynamicMesh.IsVertex(VID); });
+
+	// Mesh dégénéré (plan, ligne), on garde tous les vertex
+	if (!bSolved)
+	{
+		OutLocalHullPoints.Reserve(DynamicMesh.VertexCount());
+		for (int32 VID : DynamicMesh.VertexIndicesItr())
+		{
+			OutLocalHullPoints.Add(DynamicMesh.GetVertex(VID));
+		}
+		return true;
+	}
+
+	// Récupère les vertex uniques du hull
+	TSet<int32> HullVertices;
+	for (const FIndex3i& Triangle : HullSolver.GetTriangles())
+	{
+		HullVertices.Add(Triangle.A);
+		HullVertices.Add(Triangle.B);
+		HullVertices.Add(Triangle.C);
+	}
+
+	OutLocalHullPoints.Reserve(HullVertices.Num());
+	for (int32 VID : HullVertices)
+	{
+		OutLocalHullPoints.Add(DynamicMesh.GetVertex(VID));
+	}
+
+	return true;
+}
+
 float UPSFL_GeometryScript::ComputeProjectedHullWidth(
 	UMeshComponent* MeshComponent,
 	const FVector& ViewDirection,
@@ -1706,23 +2124,42 @@ float UPSFL_GeometryScript::ComputeProjectedHullWidth(
 
 	if (!IsValid(MeshComponent)) return 0.f;
 
-	// Convertit le mesh cible en DYNAMIC MESH (UE5 Geometry Script)
-	FDynamicMesh3 DynamicMesh;
-	if (!ConvertMeshComponentToDynamicMesh(MeshComponent, DynamicMesh)) return 0.f;
+	const UWorld* DebugWorld = bDebug ? MeshComponent->GetWorld() : nullptr;
+
+	// Sliceable : hull 3D en cache, reconstruit seulement après un slice
+	if (UPS_SlicedComponent* SlicedComponent = Cast<UPS_SlicedComponent>(MeshComponent))
+	{
+		return ComputeProjectedHullWidth(SlicedComponent->GetConvexHullPoints(), MeshComponent->GetComponentTransform(), ViewDirection, SightHitPoint, OutDatas, DebugWorld);
+	}
+
+	TArray<FVector> LocalHullPoints;
+	if (!ComputeConvexHullPoints(MeshComponent, LocalHullPoints)) return 0.f;
 
-	const FTransform& WorldTransform = MeshComponent->GetComponentTransform();
+	return ComputeProjectedHullWidth(LocalHullPoints, MeshComponent->GetComponentTransform(), ViewDirection, SightHitPoint, OutDatas, DebugWorld);
+}
+
+float UPSFL_GeometryScript::ComputeProjectedHullWidth(
+	const TArray<FVector>& LocalHullPoints,
+	const FTransform& WorldTransform,
+	const FVector& ViewDirection,
+	const FVector& SightHitPoint,
+	FHullWidthOutData& OutDatas,
+	const UWorld* DebugWorld)
+{
+	OutDatas.OutCenter3D = FVector::ZeroVector;
 
 	// Définit le plan de projection orienté vers l’arrière (car Z+ = "avant" dans FFrame3d)
 	FVector TargetCenter = SightHitPoint;
 	OutDatas.OutProjectionFrame = FFrame3d(TargetCenter, -ViewDirection);
 
-	// On projette tous les vertex sur le plan 2D
+	// On projette uniquement les vertex du hull 3D sur le plan 2D
 	TArray<FVector2d> ProjectedPoints2D;
 	TArray<FVector3d> ProjectedPoints3D; // ← Position réelle en monde
+	ProjectedPoints2D.Reserve(LocalHullPoints.Num());
+	ProjectedPoints3D.Reserve(LocalHullPoints.Num());
 	
-	for (int32 VID : DynamicMesh.VertexIndicesItr())
+	for (const FVector& Vertex : LocalHullPoints)
 	{
-		FVector3d Vertex = DynamicMesh.GetVertex(VID);
 		FVector3d WorldPos = WorldTransform.TransformPosition(Vertex);
 		const bool bIsFinite = FMath::IsFinite(WorldPos.X) && FMath::IsFinite(WorldPos.Y) && FMath::IsFinite(WorldPos.Z);
 		if (!bIsFinite) continue;
@@ -1731,7 +2168,7 @@ float UPSFL_GeometryScript::ComputeProjectedHullWidth(
 		ProjectedPoints2D.Add(FVector2d(Proj.X, Proj.Y));
 		ProjectedPoints3D.Add(WorldPos);
 
-		if (bDebug) DrawDebugPoint(MeshComponent->GetWorld(), WorldPos, 20.f, FColor::Orange, false, 0.01f);
+		if (DebugWorld) DrawDebugPoint(DebugWorld, WorldPos, 20.f, FColor::Orange, false, 0.01f);
 	}
 
 	if (ProjectedPoints2D.Num() < 2) return 0.f;
@@ -1740,24 +2177,12 @@ float UPSFL_GeometryScript::ComputeProjectedHullWidth(
 	TArray<int32> HullIndices;
 	ComputeConvexHull2D(ProjectedPoints2D, HullIndices);
 
-	// Recherche des deux points les plus éloignés du hull
-	float MaxDistSq = 0.f;
+	// Moins de 3 points projetés : le hull se réduit au segment
+	if (HullIndices.Num() < 2) HullIndices = {0, 1};
+
+	// Recherche des deux points les plus éloignés du hull (rotating calipers)
 	int32 IndexA = -1, IndexB = -1;
-	for (int32 i = 0; i < HullIndices.Num(); ++i)
-	{
-		for (int32 j = i + 1; j < HullIndices.Num(); ++j)
-		{
-			const FVector2d& A = ProjectedPoints2D[HullIndices[i]];
-			const FVector2d& B = ProjectedPoints2D[HullIndices[j]];
-			float DistSq = FVector2d::DistSquared(A, B);
-			if (DistSq > MaxDistSq)
-			{
-				MaxDistSq = DistSq;
-				IndexA = HullIndices[i];
-				IndexB = HullIndices[j];
-			}
-		}
-	}
+	const double MaxDistSq = ComputeHullDiameterRotatingCalipers(ProjectedPoints2D, HullIndices, IndexA, IndexB);
 
 	// Si les indices sont valides, on peut déterminer un centre réel en 3D
 	if (IndexA != -1 && IndexB != -1)
@@ -1820,17 +2245,82 @@ FRotator UPSFL_GeometryScript::ComputeAdjustedAimLookAt(
 
 //------------------
 #pragma endregion HullBounds
-	
-	
-
-
-
-
 
+#pragma region Benchmark
+//------------------
 
+void UPSFL_GeometryScript::BenchmarkNearestQueries(const int32 MaxTriangleCount, const int32 QueryCount)
+{
+	_bDebug = false;
 
+	for (int32 TriangleCount = 5000; TriangleCount <= MaxTriangleCount; TriangleCount *= 10)
+	{
+		// Sphère UV de ~TriangleCount triangles
+		FSphereGenerator SphereGenerator;
+		SphereGenerator.Radius = 100.0;
+		SphereGenerator.NumPhi = SphereGenerator.NumTheta = FMath::Max(3, FMath::RoundToInt(FMath::Sqrt(TriangleCount / 2.0)));
+		const FDynamicMesh3 Mesh(&SphereGenerator.Generate());
+
+		// Points autour de la surface, consécutifs comme les points d'un câble
+		TArray<FVector3d> Points;
+		Points.Reserve(QueryCount);
+		FRandomStream Random(TriangleCount);
+		for (int32 i = 0; i < QueryCount; ++i)
+		{
+			const double Alpha = static_cast<double>(i) / FMath::Max(1, QueryCount - 1);
+			const FVector3d Direction = FVector3d(FMath::Cos(Alpha * UE_DOUBLE_PI), FMath::Sin(Alpha * UE_DOUBLE_PI), Random.FRandRange(-0.2f, 0.2f)).GetSafeNormal();
+			Points.Add(Direction * Random.FRandRange(90.0f, 110.0f));
+		}
 
+		double StartTime = FPlatformTime::Seconds();
+		FPSMeshSpatialIndex SpatialIndex;
+		SpatialIndex.Build(Mesh);
+		const double BuildTime = FPlatformTime::Seconds() - StartTime;
+
+		// Triangle le plus proche
+		StartTime = FPlatformTime::Seconds();
+		for (const FVector3d& Point : Points) FindNearestTriangleBruteForce(Mesh, Point);
+		const double TriangleBruteTime = FPlatformTime::Seconds() - StartTime;
+
+		StartTime = FPlatformTime::Seconds();
+		for (const FVector3d& Point : Points) SpatialIndex.FindNearestTriangle(Point);
+		const double TriangleTreeTime = FPlatformTime::Seconds() - StartTime;
+
+		TArray<int32> TriangleIDs;
+		StartTime = FPlatformTime::Seconds();
+		SpatialIndex.FindNearestTriangles(Points, TriangleIDs);
+		const double TriangleBatchTime = FPlatformTime::Seconds() - StartTime;
+
+		// Vertex le plus proche
+		StartTime = FPlatformTime::Seconds();
+		for (const FVector3d& Point : Points) FindNearestVertexBruteForce(Mesh, Point);
+		const double VertexBruteTime = FPlatformTime::Seconds() - StartTime;
+
+		StartTime = FPlatformTime::Seconds();
+		for (const FVector3d& Point : Points) SpatialIndex.FindNearestVertex(Point);
+		const double VertexGridTime = FPlatformTime::Seconds() - StartTime;
+
+		UE_LOG(LogTemp, Log, TEXT("%S :: %d triangles, %d queries, build %.3f ms | triangle brute %.3f ms, tree %.3f ms, batch %.3f ms | vertex brute %.3f ms, grid %.3f ms"),
+			__FUNCTION__, Mesh.TriangleCount(), QueryCount, BuildTime * 1000.0,
+			TriangleBruteTime * 1000.0, TriangleTreeTime * 1000.0, TriangleBatchTime * 1000.0,
+			VertexBruteTime * 1000.0, VertexGridTime * 1000.0);
+	}
+}
 
+#if !UE_BUILD_SHIPPING
 
+// PS.Geometry.BenchmarkNearest [MaxTriangles=500000] [Queries=100]
+static FAutoConsoleCommand BenchmarkNearestQueriesCommand(
+	TEXT("PS.Geometry.BenchmarkNearest"),
+	TEXT("Compare brute force and spatial nearest triangle/vertex queries on generated spheres. Args: [MaxTriangles=500000] [Queries=100]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const int32 MaxTriangleCount = Args.IsValidIndex(0) ? FCString::Atoi(*Args[0]) : 500000;
+		const int32 QueryCount = Args.IsValidIndex(1) ? FCString::Atoi(*Args[1]) : 100;
+		UPSFL_GeometryScript::BenchmarkNearestQueries(MaxTriangleCount, FMath::Max(1, QueryCount));
+	}));
 
+#endif
 
+//------------------
+#pragma endregion Benchmark
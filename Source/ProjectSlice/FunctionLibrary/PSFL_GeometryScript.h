@@ -9,6 +9,7 @@
 //Path
 #include "DynamicMesh/DynamicMeshAABBTree3.h"
 #include "Parameterization/MeshDijkstra.h"
+#include "Spatial/PointHashGrid3.h"
 
 #include "PSFL_GeometryScript.generated.h"
 
@@ -25,44 +26,100 @@ using namespace UE::Geometry;
 //------------------
 
 // Structure pour identifier un path unique
+// Start/End sont quantifiés en cellules de grille : hash et égalité sont ainsi cohérents
 struct FPathCacheKey
 {
-	FVector StartPoint = FVector::ZeroVector;
-	FVector EndPoint = FVector::ZeroVector;
+	FIntVector StartCell = FIntVector::ZeroValue;
+	FIntVector EndCell = FIntVector::ZeroValue;
 	TWeakObjectPtr<UMeshComponent> MeshComponent = nullptr;
 
-	// Constructeur par défaut - maintenant défini inline
-	FPathCacheKey()
-		: StartPoint(FVector::ZeroVector)
-		, EndPoint(FVector::ZeroVector)
-		, MeshComponent(nullptr)
-	{}
+	FPathCacheKey() = default;
     
-	FPathCacheKey(const FVector& InStartPoint, const FVector& InEndPoint, UMeshComponent* InMeshComp)
-		: StartPoint(InStartPoint), EndPoint(InEndPoint), MeshComponent(InMeshComp){}
+	FPathCacheKey(const FVector& InStartPoint, const FVector& InEndPoint, const TWeakObjectPtr<UMeshComponent>& InMeshComp, const float CellSize)
+		: StartCell(QuantizePoint(InStartPoint, CellSize)), EndCell(QuantizePoint(InEndPoint, CellSize)), MeshComponent(InMeshComp){}
+
+	static FIntVector QuantizePoint(const FVector& Point, const float CellSize)
+	{
+		return FIntVector(FMath::FloorToInt(Point.X / CellSize), FMath::FloorToInt(Point.Y / CellSize), FMath::FloorToInt(Point.Z / CellSize));
+	}
     
 	bool operator==(const FPathCacheKey& Other) const
 	{
-		const float Tolerance = 1e-3f; // Tolérance pour la comparaison des positions
-		return FVector::DistSquared(StartPoint, Other.StartPoint) < Tolerance * Tolerance &&
-			   FVector::DistSquared(EndPoint, Other.EndPoint) < Tolerance * Tolerance &&
-			   MeshComponent == Other.MeshComponent;
+		return StartCell == Other.StartCell && EndCell == Other.EndCell && MeshComponent == Other.MeshComponent;
 	}
 };
 
-// Structure pour stocker les résultats du cache
+// Hash function pour FPathCacheKey
+inline uint32 GetTypeHash(const FPathCacheKey& Key)
+{
+	uint32 Hash = GetTypeHash(Key.StartCell);
+	Hash = HashCombine(Hash, GetTypeHash(Key.EndCell));
+	Hash = HashCombine(Hash, GetTypeHash(Key.MeshComponent));
+	return Hash;
+}
+
+// Structure pour stocker les résultats du cache, chaînée dans la liste LRU et dans le bucket de son mesh
 struct FPathCacheEntry
 {
+	FPathCacheKey Key;
 	TArray<FVector> Points;
-	double LastAccessTime;
-    
-	FPathCacheEntry()
-		: LastAccessTime(0.0)
-	{}
-    
-	FPathCacheEntry(const TArray<FVector>& InPoints)
-		: Points(InPoints), LastAccessTime(FPlatformTime::Seconds())
-	{}
+	double LastAccessTime = 0.0;
+
+	// Liste LRU intrusive (indices dans le pool d'entrées)
+	int32 LruPrev = INDEX_NONE;
+	int32 LruNext = INDEX_NONE;
+
+	// Liste intrusive des entrées du même mesh
+	int32 BucketPrev = INDEX_NONE;
+	int32 BucketNext = INDEX_NONE;
+};
+
+// Entrées d'un même mesh, invalidées en bloc quand la révision du mesh change (slice)
+struct FPathCacheMeshBucket
+{
+	uint32 MeshRevision = 0;
+	int32 Head = INDEX_NONE;
+	int32 Num = 0;
+};
+
+// Cache LRU des paths : lookup, insertion et éviction en O(1)
+class FPathLruCache
+{
+public:
+	bool Find(const FPathCacheKey& Key, const uint32 MeshRevision, const double CurrentTime, const double ExpirationTime, TArray<FVector>& OutPoints);
+
+	void Store(const FPathCacheKey& Key, const uint32 MeshRevision, const TArray<FVector>& Points, const double CurrentTime, const double ExpirationTime);
+
+	void SetMaxSize(const int32 InMaxSize);
+
+	void Empty();
+
+	FORCEINLINE int32 Num() const { return KeyToEntry.Num(); }
+
+	FORCEINLINE int32 GetMaxSize() const { return MaxSize; }
+
+	// Compteurs
+	int32 Hits = 0;
+	int32 Misses = 0;
+	int32 Evictions = 0;
+
+private:
+	void LinkFront(const int32 Index);
+
+	void UnlinkLru(const int32 Index);
+
+	void RemoveEntry(const int32 Index);
+
+	void InvalidateMesh(const TWeakObjectPtr<UMeshComponent>& MeshComponent);
+
+	TArray<FPathCacheEntry> Entries;
+	TArray<int32> FreeIndices;
+	TMap<FPathCacheKey, int32> KeyToEntry;
+	TMap<TWeakObjectPtr<UMeshComponent>, FPathCacheMeshBucket> MeshBuckets;
+
+	int32 Head = INDEX_NONE;
+	int32 Tail = INDEX_NONE;
+	int32 MaxSize = 100;
 };
 
 // Nouvelle structure pour inclure la vélocité dans le cache
@@ -113,18 +170,43 @@ struct FMeshDijkstraNode
 	{}
 };
 
-// Hash function pour FPathCacheKey
-inline uint32 GetTypeHash(const FPathCacheKey& Key)
+//------------------
+#pragma endregion Path
+
+#pragma region Spatial
+//------------------
+
+// Index spatial d'un mesh : AABB tree pour les triangles, grille de hachage creuse pour les vertex
+// Garde un pointeur sur le mesh, qui doit lui survivre. Les requêtes sont const et utilisables en parallèle
+class PROJECTSLICE_API FPSMeshSpatialIndex
 {
-	uint32 Hash = 0;
-	Hash = HashCombine(Hash, GetTypeHash(Key.StartPoint));
-	Hash = HashCombine(Hash, GetTypeHash(Key.EndPoint));
-	Hash = HashCombine(Hash, GetTypeHash(Key.MeshComponent.Get()));
-	return Hash;
-}
+public:
+	void Build(const FDynamicMesh3& InMesh);
+
+	FORCEINLINE bool IsBuilt() const { return Mesh != nullptr; }
+
+	int32 FindNearestTriangle(const FVector3d& Point, double MaxDistance = TNumericLimits<double>::Max()) const;
+
+	// Projette une série de points : chaque requête est bornée par la distance au triangle du point précédent,
+	// les points voisins (points d'un câble) ne parcourent ainsi qu'une petite partie de l'arbre
+	void FindNearestTriangles(TConstArrayView<FVector3d> Points, TArray<int32>& OutTriangleIDs) const;
+
+	int32 FindNearestVertex(const FVector3d& Point) const;
+
+private:
+	const FDynamicMesh3* Mesh = nullptr;
+	
+	FDynamicMeshAABBTree3 TriangleTree;
+	
+	TUniquePtr<TPointHashGrid3d<int32>> VertexGrid;
+	
+	double VertexCellSize = 1.0;
+	
+	double VertexMaxSearchRadius = 1.0;
+};
 
 //------------------
-#pragma endregion Path
+#pragma endregion Spatial
 
 #pragma region Hull
 //------------------
@@ -173,9 +255,21 @@ public:
 	// Version avec vélocité
 	static void ComputeGeodesicPathWithVelocity(UMeshComponent* meshComp, const FVector& startPoint, const FVector& endPoint, const FVector& velocity, TArray<FVector>& outPoints, float velocityInfluence = 0.5f, const bool bDebug = false, const bool bDebugPoint = false);
 
+	// Versions sur un mesh déjà converti : aucun accès UObject, appelables depuis un worker thread (DebugPointWorld à nullptr hors game thread)
+	// SpatialIndex optionnel (index du snapshot), sinon construit localement
+	static bool ComputeGeodesicPath(const FDynamicMesh3& Mesh, const FTransform& ComponentTransform, const FVector& startPoint, const FVector& endPoint, TArray<FVector>& outPoints, const bool bDebug = false, const UWorld* DebugPointWorld = nullptr, const FPSMeshSpatialIndex* SpatialIndex = nullptr);
+
+	static bool ComputeGeodesicPathWithVelocity(const FDynamicMesh3& Mesh, const FTransform& ComponentTransform, const FVector& startPoint, const FVector& endPoint, const FVector& velocity, TArray<FVector>& outPoints, float velocityInfluence = 0.5f, const bool bDebug = false, const UWorld* DebugPointWorld = nullptr, const FPSMeshSpatialIndex* SpatialIndex = nullptr);
+
+	// Projette un point world sur la surface du mesh
+	static bool FindNearestPointOnMesh(const FDynamicMesh3& Mesh, const FTransform& ComponentTransform, const FVector& Point, FVector& OutPoint, const bool bDebug = false, const FPSMeshSpatialIndex* SpatialIndex = nullptr);
+
+	// Version batch : projette tous les points (ex: points intermédiaires du câble) en une passe sur l'index
+	static bool ProjectPointsToMeshSurface(const FDynamicMesh3& Mesh, const FTransform& ComponentTransform, const TArray<FVector>& Points, TArray<FVector>& OutPoints, const FPSMeshSpatialIndex* SpatialIndex = nullptr);
+
 private:
 	
-	static bool ProjectPointToMeshSurface(const FDynamicMesh3& Mesh, const FDynamicMeshAABBTree3& Spatial, const FVector3d& Point, FVector3d& OutProjectedPoint, int32& OutTriangleID);
+	static bool ProjectPointToMeshSurface(const FDynamicMesh3& Mesh, const FPSMeshSpatialIndex& Spatial, const FVector3d& Point, FVector3d& OutProjectedPoint, int32& OutTriangleID);
 	
 	static bool AreVerticesConnected(const FDynamicMesh3& Mesh, int32 StartVID, int32 EndVID);
 
@@ -185,15 +279,16 @@ private:
 	
 	static void AnalyzeMeshConnectivity(const FDynamicMesh3& Mesh);
 
-	static bool FindPathBetweenComponents(const FDynamicMesh3& Mesh, int32 StartVID, int32 EndVID, TArray<int32>& OutPath);
+	static bool FindPathBetweenComponents(const FDynamicMesh3& Mesh, int32 StartVID, int32 EndVID, TArray<int32>& OutPath, const FPSMeshSpatialIndex* SpatialIndex = nullptr);
 
 	static float CalculatePathLength(const FDynamicMesh3& Mesh, const TArray<int32>& Path);
 
-	static bool CreateSurfacePath(const FDynamicMesh3& Mesh, int32 StartVID, int32 EndVID, TArray<int32>& OutPath);
+	static bool CreateSurfacePath(const FDynamicMesh3& Mesh, int32 StartVID, int32 EndVID, TArray<int32>& OutPath, const FPSMeshSpatialIndex* SpatialIndex = nullptr);
 	
-	static inline bool _bDebug = false;
+	// Par thread : les requêtes asynchrones ne partagent pas leurs flags de debug
+	static inline thread_local bool _bDebug = false;
 
-	static inline bool _bDebugPoint = false;
+	static inline thread_local const UWorld* _DebugPointWorld = nullptr;
 
 #pragma region Cache
 	//------------------
@@ -207,16 +302,28 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Geometry Script")
 	static void SetMaxCacheSize(int32 MaxSize);
 
+	// Taille des cellules de quantification des clés (cm, 1 minimum), vide le cache
+	UFUNCTION(BlueprintCallable, Category = "Geometry Script")
+	static void SetCacheCellSize(float CellSize);
+
+	UFUNCTION(BlueprintCallable, Category = "Geometry Script")
+	static void GetPathCacheStats(int32& OutHits, int32& OutMisses, int32& OutEvictions, int32& OutEntries);
+
+	// Révision de la géométrie d'un mesh, change à chaque slice d'un sliceable
+	static uint32 GetMeshRevision(const UMeshComponent* MeshComponent);
+
+	// Fonctions de gestion du cache, thread-safe (la révision est lue sur le game thread par l'appelant)
+	static FPathCacheKey MakePathCacheKey(const FVector& StartPoint, const FVector& EndPoint, const TWeakObjectPtr<UMeshComponent>& MeshComponent);
+	static bool TryGetCachedPath(const FPathCacheKey& Key, const uint32 MeshRevision, TArray<FVector>& OutPoints);
+	static void StoreCachedPath(const FPathCacheKey& Key, const uint32 MeshRevision, const TArray<FVector>& Points);
+
 private:
-	// Cache statique pour stocker les chemins calculés
-	static TMap<FPathCacheKey, FPathCacheEntry> PathCache;
-	static int32 MaxCacheSize;
+	// Cache statique pour stocker les chemins calculés, protégé par PathCacheLock
+	static FPathLruCache PathCache;
+	static float CacheCellSize;
+	static FCriticalSection PathCacheLock;
 	static constexpr double CacheExpirationTime = 300.0; // 5 minutes
-	
-	// Fonctions de gestion du cache
-	static bool TryGetCachedPath(const FPathCacheKey& Key, TArray<FVector>& OutPoints);
-	static void StoreCachedPath(const FPathCacheKey& Key, const TArray<FVector>& Points);
-	static void CleanupExpiredCache();
+	static constexpr float MinCacheCellSize = 1.0f; // 1 cm, en dessous la quantification des clés déborde int32 sur les grandes coordonnées
 
 	//------------------
 #pragma endregion Cache
@@ -235,7 +342,10 @@ private:
 	//------------------
 
 private:
-	static int32 FindNearestVertex(FDynamicMesh3& Mesh, const FVector3d& Point);
+	// Utilise l'index spatial si fourni, sinon parcours linéaire
+	static int32 FindNearestVertex(const FDynamicMesh3& Mesh, const FVector3d& Point, const FPSMeshSpatialIndex* SpatialIndex = nullptr);
+
+	static int32 FindNearestVertexBruteForce(const FDynamicMesh3& Mesh, const FVector3d& Point);
 	
 	// Fonction pour trouver le nœud non visité avec la distance minimale
 	static int32 FindMinDistanceVertex(const TMap<int32, FMeshDijkstraNode>& NodeMap, const TSet<int32>& UnvisitedVertices);
@@ -247,13 +357,15 @@ private:
 
 #pragma region MeshConverter
 	//------------------
+public:
+	// Game thread uniquement (lit les buffers du composant)
+	static bool ConvertMeshComponentToDynamicMesh(UMeshComponent* MeshComp, FDynamicMesh3& OutMesh, int32 SectionOrLODIndex = 0);
+
 private:
 	static bool ConvertProceduralMeshToDynamicMesh(UProceduralMeshComponent* ProcMesh, FDynamicMesh3& OutMesh, int32 SectionIndex = 0);
 
 	static bool ConvertStaticMeshToDynamicMesh(UStaticMeshComponent* StaticMeshComp, FDynamicMesh3& OutMesh, int32 LODIndex = 0);
 
-	static bool ConvertMeshComponentToDynamicMesh(UMeshComponent* MeshComp, FDynamicMesh3& OutMesh, int32 SectionOrLODIndex = 0);
-
 #pragma endregion MeshConverter
 
 #pragma region Dijkstra
@@ -297,10 +409,31 @@ public:
 	// Computes the 2D bounds of a Static or Procedural Mesh projected along a direction.
     // Returns 4 corners of the convex projection hull that surrounds the mesh
     // Used to scale a visual triangle from muzzle to projected edges
+    // Sliceable components provide their cached 3D hull, other meshes build it on the fly
 	static float ComputeProjectedHullWidth(UMeshComponent* MeshComponent, const FVector& ViewDirection, const FVector& SightHitPoint, FHullWidthOutData& OutDatas, bool bDebug);
 
+	// Same as above but only projects the given hull points (component space), cost depends on hull size only
+	static float ComputeProjectedHullWidth(const TArray<FVector>& LocalHullPoints, const FTransform& WorldTransform, const FVector& ViewDirection, const FVector& SightHitPoint, FHullWidthOutData& OutDatas, const UWorld* DebugWorld = nullptr);
+
+	// Builds the 3D convex hull of a mesh and outputs its unique vertices in component space
+	static bool ComputeConvexHullPoints(UMeshComponent* MeshComponent, TArray<FVector>& OutLocalHullPoints);
+
+	// Same as above from an already converted mesh, safe to call off the game thread
+	static bool ComputeConvexHullPoints(const FDynamicMesh3& DynamicMesh, TArray<FVector>& OutLocalHullPoints);
+
 	static FRotator ComputeAdjustedAimLookAt(const FVector& MuzzleLoc, const FVector& HullCenter, const FVector& ImpactPoint, const FTransform& ReferenceFrame);
 
 	//------------------
 #pragma endregion HullBounds
+
+#pragma region Benchmark
+	//------------------
+
+public:
+	// Compare brute force et index spatial (triangle/vertex le plus proche) sur des sphères de 5k à MaxTriangleCount triangles
+	// Console : PS.Geometry.BenchmarkNearest [MaxTriangles] [Queries]
+	static void BenchmarkNearestQueries(const int32 MaxTriangleCount = 500000, const int32 QueryCount = 100);
+
+	//------------------
+#pragma endregion Benchmark
 };
@@ -4,6 +4,9 @@
 #include "Engine/World.h"
 #include "CollisionQueryParams.h"
 #include "GameFramework/Actor.h"
+#include "Engine/OverlapResult.h"
+#include "Algo/Sort.h"
+#include "Async/ParallelFor.h"
 #include "PhysicsEngine/PhysicsSettings.h"
 #include "ProjectSlice/Components/PC/PS_PlayerCameraComponent.h"
 
@@ -68,209 +71,131 @@ float UPSFl::GetObjectUnifiedMass(UPrimitiveComponent* const comp, const bool bD
 
 #pragma region Time
 //------------------
-// Delay node equivalent (RealTime-based, unaffected by Time Dilation)
+// Delay node equivalent (RealTime-based, unaffected by Time Dilation), waits on a cooldown timer of the timer subsystem
 class FDelayRealTimeAction : public FPendingLatentAction
 {
 public:
-	double TargetTime;
 	FName ExecutionFunction;
 	int32 OutputLink;
 	FWeakObjectPtr CallbackTarget;
-	TWeakObjectPtr<UWorld> WeakWorld; 
+	TWeakObjectPtr<UPS_TimerSubsystem> WeakTimerSubsystem;
+	FPSTimerHandle TimerHandle;
 
-	FDelayRealTimeAction(float Duration, const FLatentActionInfo& LatentInfo, UWorld* InWorld)
-		: TargetTime((InWorld ? InWorld->GetRealTimeSeconds() : 0.0) + Duration)
-		, ExecutionFunction(LatentInfo.ExecutionFunction)
+	FDelayRealTimeAction(float Duration, const FLatentActionInfo& LatentInfo, UPS_TimerSubsystem* InTimerSubsystem)
+		: ExecutionFunction(LatentInfo.ExecutionFunction)
 		, OutputLink(LatentInfo.Linkage)
 		, CallbackTarget(LatentInfo.CallbackTarget)
-		, WeakWorld(InWorld)
-	{}
+		, WeakTimerSubsystem(InTimerSubsystem)
+	{
+		TimerHandle = InTimerSubsystem->SetTimer(FTimerDelegate(), Duration, false);
+	}
 
-	virtual void UpdateOperation(FLatentResponse& Response) override
+	virtual ~FDelayRealTimeAction() override
 	{
-		if (!WeakWorld.IsValid())
-			return;
+		// Aborted action (callback target destroyed)
+		if (WeakTimerSubsystem.IsValid()) WeakTimerSubsystem->ClearTimer(TimerHandle);
+	}
 
-		UWorld* World = WeakWorld.Get();
-		const double Now = World->GetRealTimeSeconds();
-		Response.FinishAndTriggerIf(Now >= TargetTime, ExecutionFunction, OutputLink, CallbackTarget);
+	virtual void UpdateOperation(FLatentResponse& Response) override
+	{
+		Response.FinishAndTriggerIf(!WeakTimerSubsystem.IsValid() || !WeakTimerSubsystem->IsTimerActive(TimerHandle), ExecutionFunction, OutputLink, CallbackTarget);
 	}
 };
 
 void UPSFl::DelayRealTime(const UObject* WorldContextObject, float Duration, FLatentActionInfo LatentInfo)
 {
-	if (UWorld* World = GEngine->GetWorldFromContextObjectChecked(WorldContextObject))
+	UWorld* World = GEngine->GetWorldFromContextObjectChecked(WorldContextObject);
+	UPS_TimerSubsystem* TimerSubsystem = UPS_TimerSubsystem::Get(World);
+	if (!IsValid(World) || !IsValid(TimerSubsystem)) return;
+
+	FLatentActionManager& LatentMgr = World->GetLatentActionManager();
+	if (!LatentMgr.FindExistingAction<FDelayRealTimeAction>(LatentInfo.CallbackTarget, LatentInfo.UUID))
 	{
-		FLatentActionManager& LatentMgr = World->GetLatentActionManager();
-		if (!LatentMgr.FindExistingAction<FDelayRealTimeAction>(LatentInfo.CallbackTarget, LatentInfo.UUID))
-		{
-			LatentMgr.AddNewAction(LatentInfo.CallbackTarget, LatentInfo.UUID,
-				new FDelayRealTimeAction(Duration, LatentInfo, World));
-		}
+		LatentMgr.AddNewAction(LatentInfo.CallbackTarget, LatentInfo.UUID,
+			new FDelayRealTimeAction(Duration, LatentInfo, TimerSubsystem));
 	}
 }
 
 //------------------
-// Custom Real-Time Timer system (with dilation)
+// Unified timer, every PSFl timer route to the timer subsystem
+
+void UPSFl::SetPSTimer(
+	const UObject* WorldContextObject,
+	FPSTimerHandle& InOutHandle,
+	const FTimerDelegate& InDelegate,
+	float InRate,
+	bool bLoop,
+	EPSTimerClock Clock,
+	float InFirstDelay,
+	float CustomDilation,
+	const AActor* DilationSource)
+{
+	UPS_TimerSubsystem* TimerSubsystem = UPS_TimerSubsystem::Get(WorldContextObject);
+	if (!IsValid(TimerSubsystem))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("%S :: TimerSubsystem not found!"), __FUNCTION__);
+		return;
+	}
+
+	if (InOutHandle.IsValid())
+	{
+		TimerSubsystem->ClearTimer(InOutHandle);
+	}
+
+	InOutHandle = TimerSubsystem->SetTimer(InDelegate, InRate, bLoop, InFirstDelay, Clock, CustomDilation, DilationSource);
+}
 
 void UPSFl::SetDilatedRealTimeTimer(
     UObject* WorldContextObject,
-    UPARAM(ref) FTimerHandle& InOutHandle,
+    UPARAM(ref) FPSTimerHandle& InOutHandle,
     const FTimerDelegate& InDelegate,
     float InRate,
     bool bLoop,
     float InFirstDelay,
     float CustomDilation)
 {
-    if (!WorldContextObject) 
-    {
-        UE_LOG(LogTemp, Error, TEXT("SetDilatedRealTimeTimer: WorldContextObject is null"));
-        return;
-    }
-    
-    UWorld* World = WorldContextObject->GetWorld();
-    if (!IsValid(World)) 
-    {
-        UE_LOG(LogTemp, Error, TEXT("SetDilatedRealTimeTimer: World is invalid"));
-        return;
-    }
-
-    // if (!InDelegate.IsBound())
-    // {
-    //     UE_LOG(LogTemp, Error, TEXT("SetDilatedRealTimeTimer: Delegate is not bound"));
-    //     return;
-    // }
-
-    UGameInstance* GameInstance = World->GetGameInstance();
-    if (!GameInstance)
-    {
-        UE_LOG(LogTemp, Warning, TEXT("SetDilatedRealTimeTimer: GameInstance not found!"));
-        return;
-    }
-
-    UPS_TimerSubsystem* TimerSubsystem = GameInstance->GetSubsystem<UPS_TimerSubsystem>();
-    if (!TimerSubsystem)
-    {
-        UE_LOG(LogTemp, Warning, TEXT("SetDilatedRealTimeTimer: TimerSubsystem not found!"));
-        return;
-    }
-
-    if (InOutHandle.IsValid())
-    {
-        TimerSubsystem->ClearTimer(InOutHandle);
-    }
-
-    InOutHandle = TimerSubsystem->SetTimerWithHandle(InDelegate, InRate, bLoop, InFirstDelay, CustomDilation);
-    
-    //UE_LOG(LogTemp, Warning, TEXT("SetDilatedRealTimeTimer: Handle valid = %d"), InOutHandle.IsValid());
+	SetPSTimer(WorldContextObject, InOutHandle, InDelegate, InRate, bLoop, EPSTimerClock::REAL_TIME, InFirstDelay, CustomDilation);
 }
 
-void UPSFl::ClearDilatedRealTimeTimer(FTimerHandle& InOutHandle)
+void UPSFl::ClearDilatedRealTimeTimer(FPSTimerHandle& InOutHandle)
 {
-    if (!InOutHandle.IsValid()) return;
-
-    if (UWorld* World = GWorld)
-    {
-        if (UGameInstance* GameInstance = World->GetGameInstance())
-        {
-            if (UPS_TimerSubsystem* TimerSubsystem = GameInstance->GetSubsystem<UPS_TimerSubsystem>())
-            {
-                TimerSubsystem->ClearTimer(InOutHandle);
-                return;
-            }
-        }
-    }
+	if (!InOutHandle.IsValid()) return;
+
+	if (UPS_TimerSubsystem* TimerSubsystem = UPS_TimerSubsystem::Get(GWorld))
+	{
+		TimerSubsystem->ClearTimer(InOutHandle);
+		return;
+	}
     
-    UE_LOG(LogTemp, Warning, TEXT("ClearDilatedRealTimeTimer: Could not find TimerSubsystem"));
+	UE_LOG(LogTemp, Warning, TEXT("%S :: Could not find TimerSubsystem"), __FUNCTION__);
 }
 
-bool UPSFl::IsDilatedRealTimeTimerActive(const FTimerHandle& InOutHandle)
+bool UPSFl::IsDilatedRealTimeTimerActive(const FPSTimerHandle& InOutHandle)
 {
-    if (!InOutHandle.IsValid()) return false;
-
-    if (UWorld* World = GWorld)
-    {
-        if (UGameInstance* GameInstance = World->GetGameInstance())
-        {
-            if (UPS_TimerSubsystem* TimerSubsystem = GameInstance->GetSubsystem<UPS_TimerSubsystem>())
-            {
-                return TimerSubsystem->IsTimerActive(InOutHandle);
-            }
-        }
-    }
-    
-    return false;
+	if (!InOutHandle.IsValid()) return false;
+
+	const UPS_TimerSubsystem* TimerSubsystem = UPS_TimerSubsystem::Get(GWorld);
+	return IsValid(TimerSubsystem) && TimerSubsystem->IsTimerActive(InOutHandle);
 }
 
 //------------------
-// Callback-based Timers (manual tick with lambda re-queue)
+// Callback-based Timers, fire and forget
 
 void UPSFl::SetRealTimeTimerWithCallback(UWorld* World, TFunction<void()> Callback, float Duration)
 {
-	if (!IsValid(World))
-	{
-		UE_LOG(LogTemp, Warning, TEXT("%s :: Invalid World!"), __FUNCTION__);
-		return;
-	}
-
-	const double TargetTime = World->GetRealTimeSeconds() + Duration;
-	TWeakObjectPtr<UWorld> WeakWorld = World;
-
-	TSharedRef<TFunction<void()>> Checker = MakeShared<TFunction<void()>>();
-	*Checker = [WeakWorld, Callback = MoveTemp(Callback), TargetTime, Checker]()
-	{
-		if (!WeakWorld.IsValid()) return;
-		UWorld* LocalWorld = WeakWorld.Get();
-		if (LocalWorld->GetRealTimeSeconds() >= TargetTime)
-		{
-			Callback();
-		}
-		else
-		{
-			LocalWorld->GetTimerManager().SetTimerForNextTick(
-				FTimerDelegate::CreateLambda(*Checker)
-			);
-		}
-	};
-
-	World->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateLambda(*Checker));
+	SetDilatedRealTimeTimerWithCallback(World, MoveTemp(Callback), Duration, 1.0f);
 }
 
 void UPSFl::SetDilatedRealTimeTimerWithCallback(UWorld* World, TFunction<void()> Callback, float Duration, float CustomDilation)
 {
 	if (!IsValid(World))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("%s :: Invalid World!"), __FUNCTION__);
+		UE_LOG(LogTemp, Warning, TEXT("%S :: Invalid World!"), __FUNCTION__);
 		return;
 	}
 
-	if (CustomDilation <= 0.f)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("%s :: Invalid CustomDilation %.2f, forcing 1.0"), __FUNCTION__, CustomDilation);
-		CustomDilation = 1.f;
-	}
-
-	const double TargetTime = World->GetRealTimeSeconds() + (Duration / CustomDilation);
-	TWeakObjectPtr<UWorld> WeakWorld = World;
-
-	TSharedRef<TFunction<void()>> Checker = MakeShared<TFunction<void()>>();
-	*Checker = [WeakWorld, Callback = MoveTemp(Callback), TargetTime, Checker]()
-	{
-		if (!WeakWorld.IsValid()) return;
-		UWorld* LocalWorld = WeakWorld.Get();
-		if (LocalWorld->GetRealTimeSeconds() >= TargetTime)
-		{
-			Callback();
-		}
-		else
-		{
-			LocalWorld->GetTimerManager().SetTimerForNextTick(
-				FTimerDelegate::CreateLambda(*Checker)
-			);
-		}
-	};
-
-	World->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateLambda(*Checker));
+	FPSTimerHandle callbackHandle;
+	SetPSTimer(World, callbackHandle, FTimerDelegate::CreateLambda([Callback = MoveTemp(Callback)]() { Callback(); }), Duration, false, EPSTimerClock::REAL_TIME, -1.f, CustomDilation);
 }
 
 #pragma endregion Time
@@ -460,180 +385,210 @@ FCollisionQueryParams UPSFl::CustomConfigureCollisionParams(FName TraceTag, bool
 	return Params;
 }
 
-void UPSFl::SweepConeMultiByChannel(
+void UPSFl::OverlapConeMultiByChannel(
 		UWorld* World,
 		FVector ConeApex,
 		FVector ConeDirection,
 		float ConeAngleDegrees,
 		float ConeLength,
-		float StepInterval,
 		TArray<FHitResult>& OutHits,
 		ECollisionChannel TraceChannel,
 		const TArray<AActor*>& ActorsToIgnore,
 		bool bDebug)
 {
 	if (!World) return;
-    
-    //Normaliser && check validity
-    ConeDirection.Normalize();
-    if (ConeDirection.IsNearlyZero() || ConeLength <= 0.0f || StepInterval <= 0.0f) return;
-    
-    //Pré-calculate const var
-    const float ConeAngleRadians = FMath::DegreesToRadians(ConeAngleDegrees);
-    const float StepSize = ConeLength / StepInterval;
-    const int32 NumSteps = FMath::FloorToInt(StepInterval);
-    
-    //Reserve space for avoid reallocation
-    OutHits.Reserve(NumSteps * 8); // Average estimated hits per step
-    
-    // Re-use collision params
-    static const FName SphereTraceMultiName(TEXT("SweepTraceCone"));
-    const FCollisionQueryParams QueryParams = CustomConfigureCollisionParams(
-        SphereTraceMultiName, false, ActorsToIgnore, true, World);
-    
-    // Re-use table for avoid multiple allocation
-    TArray<FHitResult> SphereHitResults;
-    SphereHitResults.Reserve(16);
-    
-    //Pre-calculate const var
-    const FQuat Identity = FQuat::Identity;
-
-	// Sweep multiple spheres along the cone's length
-    for (int32 Step = 0; Step < NumSteps; ++Step)
-    {
-    	// Calculate the distance along the cone
-        const float Distance = StepSize * Step;
-        
-        // Skip spheres with radius 0 on begin
-        if (Distance < KINDA_SMALL_NUMBER) continue;
-        
-        const float Radius = Distance * ConeAngleRadians;
-        const FVector SphereCenter = ConeApex + (ConeDirection * Distance);
-        
-        //Make shape
-        const FCollisionShape Sphere = FCollisionShape::MakeSphere(Radius);
-        
-        //Reset Tab
-        SphereHitResults.Reset();
-        
-        if (World->SweepMultiByChannel(SphereHitResults, SphereCenter, SphereCenter, 
-            Identity, TraceChannel, Sphere, QueryParams))
-        {
-            OutHits.Append(SphereHitResults);
-        }
-        
-        // Debug
-        if (bDebug)
-        {
-            DrawDebugSphere(World, SphereCenter, Radius, 8, FColor::Red, false, 1.0f);
-        }
-    }
-	
-    if (bDebug)
-    {
-        DrawDebugCone(World, ConeApex, ConeDirection, ConeLength, 
-            ConeAngleRadians, ConeAngleRadians, 8, FColor::Green, false, 5.0f);
-        
-        const FVector ConeEnd = ConeApex + (ConeDirection * ConeLength);
-        const float EndRadius = ConeLength * ConeAngleRadians;
-        DrawDebugSphere(World, ConeEnd, EndRadius, 8, FColor::Green, false, 1.0f);
-    }
+
+	//Normaliser && check validity
+	ConeDirection.Normalize();
+	if (ConeDirection.IsNearlyZero() || ConeLength <= 0.0f) return;
+
+	//Pré-calculate const var
+	const float ConeAngleRadians = FMath::DegreesToRadians(FMath::Clamp(ConeAngleDegrees, 0.0f, 89.0f));
+	const float EndRadius = ConeLength * FMath::Tan(ConeAngleRadians);
+
+	//Smallest sphere containing the cone: circumsphere of apex + base circle for narrow cones, base sphere otherwise
+	float BoundRadius = EndRadius;
+	FVector BoundCenter = ConeApex + ConeDirection * ConeLength;
+	if (EndRadius < ConeLength)
+	{
+		BoundRadius = (FMath::Square(ConeLength) + FMath::Square(EndRadius)) / (2.0f * ConeLength);
+		BoundCenter = ConeApex + ConeDirection * BoundRadius;
+	}
+
+	// Re-use collision params
+	static const FName ConeOverlapName(TEXT("OverlapCone"));
+	const FCollisionQueryParams QueryParams = CustomConfigureCollisionParams(
+		ConeOverlapName, false, ActorsToIgnore, true, World);
+
+	// Single broadphase query
+	TArray<FOverlapResult> Overlaps;
+	World->OverlapMultiByChannel(Overlaps, BoundCenter, FQuat::Identity, TraceChannel, FCollisionShape::MakeSphere(BoundRadius), QueryParams);
+
+	// Unique candidates, a component can be returned once per body
+	TArray<UPrimitiveComponent*, TInlineAllocator<32>> Candidates;
+	TArray<float> CentersX, CentersY, CentersZ, Radii;
+	CentersX.Reserve(Overlaps.Num());
+	CentersY.Reserve(Overlaps.Num());
+	CentersZ.Reserve(Overlaps.Num());
+	Radii.Reserve(Overlaps.Num());
+	for (const FOverlapResult& Overlap : Overlaps)
+	{
+		UPrimitiveComponent* OverlapComp = Overlap.GetComponent();
+		if (!IsValid(OverlapComp) || Candidates.Contains(OverlapComp)) continue;
+
+		Candidates.Add(OverlapComp);
+		CentersX.Add(OverlapComp->Bounds.Origin.X);
+		CentersY.Add(OverlapComp->Bounds.Origin.Y);
+		CentersZ.Add(OverlapComp->Bounds.Origin.Z);
+		Radii.Add(OverlapComp->Bounds.SphereRadius);
+	}
+
+	// Exact cone test on all candidates at once
+	TArray<bool> Inside;
+	ConeIntersectSpheres(ConeApex, ConeDirection, ConeAngleRadians, ConeLength, CentersX, CentersY, CentersZ, Radii, Inside);
+
+	OutHits.Reserve(OutHits.Num() + Candidates.Num());
+	for (int32 Index = 0; Index < Candidates.Num(); ++Index)
+	{
+		if (!Inside[Index]) continue;
+
+		UPrimitiveComponent* HitComp = Candidates[Index];
+
+		// Impact on collision nearest to apex, bounds origin if component has no collision geometry
+		FVector ImpactPoint;
+		if (HitComp->GetClosestPointOnCollision(ConeApex, ImpactPoint) < 0.0f)
+		{
+			ImpactPoint = HitComp->Bounds.Origin;
+		}
+
+		FHitResult Hit(HitComp->GetOwner(), HitComp, ImpactPoint, (ConeApex - ImpactPoint).GetSafeNormal());
+		Hit.TraceStart = ConeApex;
+		Hit.TraceEnd = ConeApex + ConeDirection * ConeLength;
+		Hit.Distance = FVector::Dist(ConeApex, ImpactPoint);
+		OutHits.Add(Hit);
+
+		// Debug
+		if (bDebug)
+		{
+			DrawDebugPoint(World, ImpactPoint, 10.0f, FColor::Purple, false, 2.0f, 5.0f);
+		}
+	}
+
+	// Sort by distance (nearest to farthest)
+	Algo::Sort(OutHits, [](const FHitResult& A, const FHitResult& B)
+	{
+		return A.Distance < B.Distance;
+	});
+
+	if (bDebug)
+	{
+		DrawDebugCone(World, ConeApex, ConeDirection, ConeLength,
+			ConeAngleRadians, ConeAngleRadians, 8, FColor::Green, false, 5.0f);
+		DrawDebugSphere(World, BoundCenter, BoundRadius, 12, FColor::Red, false, 1.0f);
+
+		UE_LOG(LogTemp, Log, TEXT("%S :: overlaps %i, candidates %i, hits %i"), __FUNCTION__, Overlaps.Num(), Candidates.Num(), OutHits.Num());
+	}
 }
 
-void UPSFl::SweepConeMultiByChannel(
+void UPSFl::OverlapConeMultiByChannel(
 		UWorld* World,
 		FVector ConeApex,
 		FVector ConeDirection,
 		float ConeAngleDegrees,
 		float ConeLength,
-		float StepInterval,
 		TArray<UPrimitiveComponent*>& OutHitComponents,
 		ECollisionChannel TraceChannel,
 		const TArray<AActor*>& ActorsToIgnore,
 		bool bDebug)
-{	
-	 if (!World) return;
-    
-	//Normaliser && check validity
-    ConeDirection.Normalize();
-    if (ConeDirection.IsNearlyZero() || ConeLength <= 0.0f || StepInterval <= 0.0f) return;
+{
+	TArray<FHitResult> Hits;
+	OverlapConeMultiByChannel(World, ConeApex, ConeDirection, ConeAngleDegrees, ConeLength, Hits, TraceChannel, ActorsToIgnore, bDebug);
 
-	//Pré-calculate const var
-    const float ConeAngleRadians = FMath::DegreesToRadians(ConeAngleDegrees);
-    const float StepSize = ConeLength / StepInterval;
-    const int32 NumSteps = FMath::FloorToInt(StepInterval);
-    
-    // Use TSet for avoid doubles
-    TSet<UPrimitiveComponent*> UniqueComponents;
-    UniqueComponents.Reserve(NumSteps * 4); // Estimation
+	OutHitComponents.Reset(Hits.Num());
+	for (const FHitResult& Hit : Hits)
+	{
+		OutHitComponents.Add(Hit.GetComponent());
+	}
+}
 
-	// Re-use collision params
-    static const FName SphereTraceMultiName(TEXT("SweepTraceCone"));
-    const FCollisionQueryParams QueryParams = CustomConfigureCollisionParams(
-        SphereTraceMultiName, false, ActorsToIgnore, true, World);
-
-	// Re-use table for avoid multiple allocation
-    TArray<FHitResult> SphereHitResults;
-    SphereHitResults.Reserve(16);
-
-	//Pre-calculate const var
-    const FQuat Identity = FQuat::Identity;
-
-	// Sweep multiple spheres along the cone's length
-    for (int32 Step = 0; Step < NumSteps; ++Step)
-    {
-    	// Calculate the distance along the cone
-        const float Distance = StepSize * Step;
-
-    	// Skip spheres with radius 0 on begin
-        if (Distance < KINDA_SMALL_NUMBER) continue;
-        
-        const float Radius = Distance * ConeAngleRadians;
-        const FVector SphereCenter = ConeApex + (ConeDirection * Distance);
-
-    	//Make shape
-        const FCollisionShape Sphere = FCollisionShape::MakeSphere(Radius);
-
-    	//Reset Tab
-        SphereHitResults.Reset();
-        
-        if (World->SweepMultiByChannel(SphereHitResults, SphereCenter, SphereCenter, 
-            Identity, TraceChannel, Sphere, QueryParams))
-        {
-            for (const FHitResult& Hit : SphereHitResults)
-            {
-                if (UPrimitiveComponent* HitComp = Hit.GetComponent())
-                {
-                    if (IsValid(HitComp))
-                    {
-                        UniqueComponents.Add(HitComp);
-
-                    	// Debug
-                        if (bDebug)
-                        {
-                            DrawDebugPoint(World, Hit.ImpactPoint, 10.0f, 
-                                FColor::Purple, false, 2.0f, 5.0f);
-                        }
-                    }
-                }
-            }
-        }
-    }
-    
-    //Convert Set to Array
-    OutHitComponents.Reset();
-    OutHitComponents.Reserve(UniqueComponents.Num());
-    for (UPrimitiveComponent* Comp : UniqueComponents)
-    {
-        OutHitComponents.Add(Comp);
-    }
-    
-    // Debug
-    if (bDebug)
-    {
-        DrawDebugCone(World, ConeApex, ConeDirection, ConeLength, 
-            ConeAngleRadians, ConeAngleRadians, 8, FColor::Green, false, 5.0f);
-    }
+void UPSFl::LineTraceSingleBatchByChannel(
+		UWorld* World,
+		const TArray<FVector>& Starts,
+		const TArray<FVector>& Ends,
+		TArray<FHitResult>& OutHits,
+		ECollisionChannel TraceChannel,
+		const TArray<AActor*>& ActorsToIgnore,
+		bool bDebug)
+{
+	OutHits.Reset();
+	if (!World || Starts.Num() != Ends.Num() || Starts.IsEmpty()) return;
+
+	static const FName LineTraceBatchName(TEXT("LineTraceBatch"));
+	const FCollisionQueryParams QueryParams = CustomConfigureCollisionParams(
+		LineTraceBatchName, false, ActorsToIgnore, true, World);
+
+	OutHits.SetNum(Starts.Num());
+
+	// Scene queries are read only, each task write its own result slot. Small batch stay on game thread
+	ParallelFor(Starts.Num(), [&](const int32 Index)
+	{
+		World->LineTraceSingleByChannel(OutHits[Index], Starts[Index], Ends[Index], TraceChannel, QueryParams);
+	}, Starts.Num() < LineTraceBatchMinParallel ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	// Debug drawing is game thread only
+	if (bDebug)
+	{
+		for (int32 Index = 0; Index < OutHits.Num(); ++Index)
+		{
+			const FHitResult& Hit = OutHits[Index];
+			DrawDebugLine(World, Starts[Index], Hit.bBlockingHit ? Hit.ImpactPoint : Ends[Index], Hit.bBlockingHit ? FColor::Red : FColor::Green, false, 2.0f);
+			if (Hit.bBlockingHit) DrawDebugPoint(World, Hit.ImpactPoint, 10.0f, FColor::Red, false, 2.0f);
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("%S :: %i traces"), __FUNCTION__, OutHits.Num());
+	}
+}
+
+void UPSFl::ConeIntersectSpheres(const FVector& coneApex, const FVector& coneDirection, const float coneHalfAngleRad, const float coneLength,
+	const TArray<float>& centersX, const TArray<float>& centersY, const TArray<float>& centersZ, const TArray<float>& radii, TArray<bool>& outInside)
+{
+	const int32 count = radii.Num();
+	outInside.SetNumUninitialized(count);
+	if (count == 0) return;
+
+	//Cone in 2D (axial, radial): apex (0,0), slant to (L,R), base from (L,0) to (L,R)
+	const float apexX = coneApex.X, apexY = coneApex.Y, apexZ = coneApex.Z;
+	const float dirX = coneDirection.X, dirY = coneDirection.Y, dirZ = coneDirection.Z;
+	const float tanAngle = FMath::Tan(coneHalfAngleRad);
+	const float endRadius = coneLength * tanAngle;
+	const float invSlantSq = 1.0f / (FMath::Square(coneLength) + FMath::Square(endRadius));
+
+	const float* RESTRICT cx = centersX.GetData();
+	const float* RESTRICT cy = centersY.GetData();
+	const float* RESTRICT cz = centersZ.GetData();
+	const float* RESTRICT cr = radii.GetData();
+	bool* RESTRICT inside = outInside.GetData();
+
+	//Branchless body, compiler can vectorize it over candidates
+	for (int32 i = 0; i < count; ++i)
+	{
+		const float vx = cx[i] - apexX;
+		const float vy = cy[i] - apexY;
+		const float vz = cz[i] - apexZ;
+
+		const float axial = vx * dirX + vy * dirY + vz * dirZ;
+		const float radial = FMath::Sqrt(FMath::Max(vx * vx + vy * vy + vz * vz - axial * axial, 0.0f));
+
+		//Nearest point on slant segment
+		const float t = FMath::Clamp((axial * coneLength + radial * endRadius) * invSlantSq, 0.0f, 1.0f);
+		const float slantDistSq = FMath::Square(axial - t * coneLength) + FMath::Square(radial - t * endRadius);
+
+		//Nearest point on base disk
+		const float baseDistSq = FMath::Square(axial - coneLength) + FMath::Square(FMath::Max(radial - endRadius, 0.0f));
+
+		const bool bCenterInside = axial >= 0.0f && axial <= coneLength && radial <= axial * tanAngle;
+		inside[i] = bCenterInside | (FMath::Min(slantDistSq, baseDistSq) <= cr[i] * cr[i]);
+	}
 }
 
 
@@ -670,13 +625,11 @@ bool UPSFl::FindClosestPointOnActor(const AActor* actorToTest, const FVector& fr
 #pragma region Cooldown
 //------------------
 
-void UPSFl::StartCooldown(UWorld* World, float coolDownDuration,UPARAM(ref) FTimerHandle& timerHandler, const float customDilation)
+void UPSFl::StartCooldown(UWorld* World, float coolDownDuration,UPARAM(ref) FPSTimerHandle& timerHandler, const float customDilation, const AActor* dilationSource)
 {
-	if (!World) return;
-	
-	FTimerDelegate timerDelegate;
-	SetDilatedRealTimeTimer(World, timerHandler, timerDelegate, coolDownDuration, false, -1.f, customDilation);
-
+	//No delegate, cooldown is only queried. Actor clock is rescaled when slowmo changes mid cooldown
+	const EPSTimerClock clock = IsValid(dilationSource) ? EPSTimerClock::ACTOR_TIME : EPSTimerClock::REAL_TIME;
+	SetPSTimer(World, timerHandler, FTimerDelegate(), coolDownDuration, false, clock, -1.f, customDilation, dilationSource);
 }
 
 //------------------
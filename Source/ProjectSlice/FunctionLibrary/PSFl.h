@@ -2,6 +2,7 @@
 
 
 #include "ProjectSlice/Components/PC/PS_PlayerCameraComponent.h"
+#include "ProjectSlice/System/PS_TimerSubsystem.h"
 #include "PSFl.generated.h"
 
 UCLASS(ClassGroup="FunctionLibrary", Category = "Misc", meta = (ToolTip="General project function library."))
@@ -53,11 +54,33 @@ public:
 
 public:
 	
+	/**
+	 * @brief Unified timer, game, real or actor time, re-scaled when slowmo change dilation
+	 * @param WorldContextObject: world usage context
+	 * @param InOutHandle: cleared if valid then set to the new timer
+	 * @param InDelegate: unbound for a cooldown only queried with IsDilatedRealTimeTimerActive
+	 * @param Clock: time the rate count in
+	 * @param CustomDilation: multiply the clock rate
+	 * @param DilationSource: actor followed by ACTOR_TIME clock
+	 * @return none
+	*/
+	static void SetPSTimer(
+		const UObject* WorldContextObject,
+		FPSTimerHandle& InOutHandle,
+		const FTimerDelegate& InDelegate,
+		float InRate,
+		bool bLoop,
+		EPSTimerClock Clock,
+		float InFirstDelay = -1.f,
+		float CustomDilation = 1.f,
+		const AActor* DilationSource = nullptr
+	);
+	
 	/** Wrapper type SetTimer (RealTime + CustomDilation) */
 	static void SetDilatedRealTimeTimer(
 		UObject* WorldContextObject,
 		UPARAM(ref)
-		FTimerHandle& InOutHandle,
+		FPSTimerHandle& InOutHandle,
 		const FTimerDelegate& InDelegate,
 		float InRate,
 		bool bLoop,
@@ -66,10 +89,10 @@ public:
 	);
 
 	/** Equivalent ClearTimer */
-	static void ClearDilatedRealTimeTimer(UPARAM(ref) FTimerHandle& InOutHandle);
+	static void ClearDilatedRealTimeTimer(UPARAM(ref) FPSTimerHandle& InOutHandle);
 
 	/** Equivalent IsTimerActive */
-	static bool IsDilatedRealTimeTimerActive(const FTimerHandle& InOutHandle);
+	static bool IsDilatedRealTimeTimerActive(const FPSTimerHandle& InOutHandle);
 
 	/**
 	 * @brief Set a Timer wnort affected by Dilation
@@ -171,57 +194,84 @@ public:
 	static FCollisionQueryParams CustomConfigureCollisionParams(FName TraceTag, bool bTraceComplex, const TArray<AActor*>& ActorsToIgnore, bool bIgnoreSelf, const UObject* WorldContextObject);
 	
 	/**
-	 * @brief Made a cone Sweep trace test and return HitResult
+	 * @brief Single overlap cone test, one broadphase query with the cone bounding sphere then exact cone vs bounds test per component
 	 * @param World: World reference
 	 * @param ConeApex: Cone base start loc
 	 * @param ConeDirection: Conde direction
-	 * @param ConeAngleDegrees: maximum velocity threshold
+	 * @param ConeAngleDegrees: Cone half angle
 	 * @param ConeLength: Cone length in cm
-	 * @param StepInterval: Sweep multiple spheres along the cone's length refresh rate
-	 * @param SphereRadius: Sweep sphere radius.
-	 * @param OutHits: Array of FHitResult founded in cone radius
+	 * @param OutHits: One FHitResult per component founded in cone, sorted by distance to apex
 	 * @param TraceChannel: Trace channel to test
-	 * @param QueryParams: Collsion query params (ignored actor ect...).
+	 * @param ActorsToIgnore: Ignored actors
 	 * @return the void
 	 */
-	static void SweepConeMultiByChannel(
+	static void OverlapConeMultiByChannel(
 		UWorld* World,
 		FVector ConeApex,
 		FVector ConeDirection,
 		float ConeAngleDegrees,
 		float ConeLength,
-		float StepInterval,
 		TArray<FHitResult>& OutHits,
 		ECollisionChannel TraceChannel,
 		const TArray<AActor*>& ActorsToIgnore,
 		bool bDebug);
 
 	/**
-	 * @brief Made a cone Sweep trace test and return array of component use no duplicates
+	 * @brief Single overlap cone test and return array of component, no duplicates, sorted by distance to apex
 	 * @param World: World reference
 	 * @param ConeApex: Cone base start loc
 	 * @param ConeDirection: Conde direction
-	 * @param ConeAngleDegrees: maximum velocity threshold
+	 * @param ConeAngleDegrees: Cone half angle
 	 * @param ConeLength: Cone length in cm
-	 * @param StepInterval: Sweep multiple spheres along the cone's length refresh rate
-	 * @param SphereRadius: Sweep sphere radius.
-	 * @param OutHitComponents: Array of components founded in cone radius
+	 * @param OutHitComponents: Array of components founded in cone
 	 * @param TraceChannel: Trace channel to test
-	 * @param QueryParams: Collsion query params (ignored actor ect...).
+	 * @param ActorsToIgnore: Ignored actors
 	 * @return the void
 	 */
-	static void SweepConeMultiByChannel(
+	static void OverlapConeMultiByChannel(
 		UWorld* World,
 		FVector ConeApex,
 		FVector ConeDirection,
 		float ConeAngleDegrees,
 		float ConeLength,
-		float StepInterval,
 		TArray<UPrimitiveComponent*>& OutHitComponents,
 		ECollisionChannel TraceChannel,
 		const TArray<AActor*>& ActorsToIgnore,
 		bool bDebug);
 
+	/**
+	 * @brief Line trace batch, traces run in parallel on task threads against the read only scene, results available on return
+	 * @param World: World reference
+	 * @param Starts: trace start of each request
+	 * @param Ends: trace end of each request, same count as Starts
+	 * @param OutHits: one FHitResult per request, same order
+	 * @param TraceChannel: Trace channel to test
+	 * @param ActorsToIgnore: Ignored actors
+	 * @param bDebug: draw traces after the batch
+	 * @return the void
+	 */
+	static void LineTraceSingleBatchByChannel(
+		UWorld* World,
+		const TArray<FVector>& Starts,
+		const TArray<FVector>& Ends,
+		TArray<FHitResult>& OutHits,
+		ECollisionChannel TraceChannel,
+		const TArray<AActor*>& ActorsToIgnore,
+		bool bDebug);
+
+private:
+	// Under this count the trace batch run on calling thread, task dispatch cost more than the traces
+	static constexpr int32 LineTraceBatchMinParallel = 4;
+
+	/**
+	 * @brief Exact solid cone vs sphere test on a batch of spheres (SoA, vectorizable loop)
+	 * @param centersX, centersY, centersZ, radii: candidates bounding spheres
+	 * @param outInside: true for each sphere touching the cone
+	 */
+	static void ConeIntersectSpheres(const FVector& coneApex, const FVector& coneDirection, const float coneHalfAngleRad, const float coneLength,
+		const TArray<float>& centersX, const TArray<float>& centersY, const TArray<float>& centersZ, const TArray<float>& radii, TArray<bool>& outInside);
+
+public:
 	/**
 	 * @brief Find closest point on acotr mesh collision
 	 * @param actorToTest: actor to test collision
@@ -245,12 +295,13 @@ public:
 	 * @param World: World reference
 	 * @param customDilation
 	 * @param Duration: durartion of cooldown
-	 * @param FTimerHandle: timerHandler output
+	 * @param timerHandler: timerHandler output
+	 * @param dilationSource: cooldown counts in this actor time, real time if null
 	 * @return the cooldown timerhandler
 	 */
 	UFUNCTION(BlueprintCallable)
 	static void StartCooldown(UWorld* World, float coolDownDuration,UPARAM(ref)
-		FTimerHandle& timerHandler, float customDilation = 1.0f);
+		FPSTimerHandle& timerHandler, float customDilation = 1.0f, const AActor* dilationSource = nullptr);
 	
 	//------------------
 #pragma endregion Cooldown
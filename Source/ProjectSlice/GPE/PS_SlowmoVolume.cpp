@@ -0,0 +1,155 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "PS_SlowmoVolume.h"
+
+#include "Components/BoxComponent.h"
+#include "Components/SphereComponent.h"
+#include "GameFramework/Pawn.h"
+#include "ProjectSlice/System/PS_SlowmoVolumeSubsystem.h"
+
+
+// Sets default values
+APS_SlowmoVolume::APS_SlowmoVolume()
+{
+	PrimaryActorTick.bCanEverTick = false;
+
+	SphereCollider = CreateDefaultSubobject<USphereComponent>(TEXT("SphereCollider"));
+	SphereCollider->InitSphereRadius(500.0f);
+	SphereCollider->SetCollisionProfileName(TEXT("OverlapAllDynamic"));
+	SphereCollider->SetGenerateOverlapEvents(true);
+	SphereCollider->SetCanEverAffectNavigation(false);
+	RootComponent = SphereCollider;
+
+	BoxCollider = CreateDefaultSubobject<UBoxComponent>(TEXT("BoxCollider"));
+	BoxCollider->InitBoxExtent(FVector(500.0f));
+	BoxCollider->SetCollisionProfileName(TEXT("OverlapAllDynamic"));
+	BoxCollider->SetGenerateOverlapEvents(true);
+	BoxCollider->SetCanEverAffectNavigation(false);
+	BoxCollider->SetupAttachment(SphereCollider);
+}
+
+void APS_SlowmoVolume::OnConstruction(const FTransform& Transform)
+{
+	Super::OnConstruction(Transform);
+
+	//Only the selected shape collides
+	const bool bIsSphere = Shape == ESlowmoVolumeShape::SPHERE;
+	SphereCollider->SetCollisionEnabled(bIsSphere ? ECollisionEnabled::QueryOnly : ECollisionEnabled::NoCollision);
+	SphereCollider->SetGenerateOverlapEvents(bIsSphere);
+	SphereCollider->SetVisibility(bIsSphere);
+
+	BoxCollider->SetCollisionEnabled(bIsSphere ? ECollisionEnabled::NoCollision : ECollisionEnabled::QueryOnly);
+	BoxCollider->SetGenerateOverlapEvents(!bIsSphere);
+	BoxCollider->SetVisibility(!bIsSphere);
+}
+
+// Called when the game starts or when spawned
+void APS_SlowmoVolume::BeginPlay()
+{
+	Super::BeginPlay();
+
+	_SlowmoVolumeSubsystem = IsValid(GetWorld()) ? GetWorld()->GetSubsystem<UPS_SlowmoVolumeSubsystem>() : nullptr;
+	if(!IsValid(_SlowmoVolumeSubsystem)) return;
+
+	UShapeComponent* activeShape = GetActiveShape();
+	if(!IsValid(activeShape)) return;
+
+	activeShape->OnComponentBeginOverlap.AddUniqueDynamic(this, &APS_SlowmoVolume::OnShapeBeginOverlap);
+	activeShape->OnComponentEndOverlap.AddUniqueDynamic(this, &APS_SlowmoVolume::OnShapeEndOverlap);
+
+	//Actors already inside at start don't trigger begin overlap
+	TArray<UPrimitiveComponent*> overlappingComponents;
+	activeShape->GetOverlappingComponents(overlappingComponents);
+	for (UPrimitiveComponent* overlappingComponent : overlappingComponents)
+	{
+		if(IsValid(overlappingComponent)) AddOverlap(overlappingComponent->GetOwner());
+	}
+}
+
+void APS_SlowmoVolume::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if(IsValid(_SlowmoVolumeSubsystem))
+	{
+		for (const TPair<TObjectKey<AActor>, int32>& overlap : _OverlapCounts)
+		{
+			_SlowmoVolumeSubsystem->LeaveVolume(this, overlap.Key.ResolveObjectPtr());
+		}
+	}
+	_OverlapCounts.Empty();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+UShapeComponent* APS_SlowmoVolume::GetActiveShape() const
+{
+	return Shape == ESlowmoVolumeShape::SPHERE ? static_cast<UShapeComponent*>(SphereCollider) : static_cast<UShapeComponent*>(BoxCollider);
+}
+
+void APS_SlowmoVolume::SetTimeDilation(const float newTimeDilation)
+{
+	const float clampedDilation = FMath::Max(newTimeDilation, 0.01f);
+	if(FMath::IsNearlyEqual(clampedDilation, TimeDilation)) return;
+
+	TimeDilation = clampedDilation;
+	MarkMembersDirty();
+}
+
+void APS_SlowmoVolume::SetPriority(const int32 newPriority)
+{
+	if(newPriority == Priority) return;
+
+	Priority = newPriority;
+	MarkMembersDirty();
+}
+
+void APS_SlowmoVolume::OnShapeBeginOverlap(UPrimitiveComponent* overlappedComponent, AActor* otherActor, UPrimitiveComponent* otherComp, int32 otherBodyIndex, bool bFromSweep, const FHitResult& sweepResult)
+{
+	AddOverlap(otherActor);
+}
+
+void APS_SlowmoVolume::OnShapeEndOverlap(UPrimitiveComponent* overlappedComponent, AActor* otherActor, UPrimitiveComponent* otherComp, int32 otherBodyIndex)
+{
+	RemoveOverlap(otherActor);
+}
+
+bool APS_SlowmoVolume::CanAffect(const AActor* actor) const
+{
+	if(!IsValid(actor) || actor == this || actor->IsActorBeingDestroyed()) return false;
+
+	const APawn* pawn = Cast<APawn>(actor);
+	return bAffectPlayer || !IsValid(pawn) || !pawn->IsPlayerControlled();
+}
+
+void APS_SlowmoVolume::AddOverlap(AActor* actor)
+{
+	if(!CanAffect(actor) || !IsValid(_SlowmoVolumeSubsystem)) return;
+
+	int32& overlapCount = _OverlapCounts.FindOrAdd(actor);
+	if(++overlapCount > 1) return;
+
+	_SlowmoVolumeSubsystem->EnterVolume(this, actor);
+
+	if(bDebug) UE_LOG(LogTemp, Log, TEXT("%S :: %s enter %s"), __FUNCTION__, *actor->GetActorNameOrLabel(), *GetActorNameOrLabel());
+}
+
+void APS_SlowmoVolume::RemoveOverlap(AActor* actor)
+{
+	int32* overlapCount = _OverlapCounts.Find(actor);
+	if(!overlapCount || --(*overlapCount) > 0) return;
+
+	_OverlapCounts.Remove(actor);
+	if(IsValid(_SlowmoVolumeSubsystem)) _SlowmoVolumeSubsystem->LeaveVolume(this, actor);
+
+	if(bDebug) UE_LOG(LogTemp, Log, TEXT("%S :: %s leave %s"), __FUNCTION__, *GetNameSafe(actor), *GetActorNameOrLabel());
+}
+
+void APS_SlowmoVolume::MarkMembersDirty()
+{
+	if(!IsValid(_SlowmoVolumeSubsystem)) return;
+
+	for (const TPair<TObjectKey<AActor>, int32>& overlap : _OverlapCounts)
+	{
+		_SlowmoVolumeSubsystem->MarkActorDirty(overlap.Key.ResolveObjectPtr());
+	}
+}
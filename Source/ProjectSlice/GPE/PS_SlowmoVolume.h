@@ -0,0 +1,101 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "UObject/ObjectKey.h"
+#include "PS_SlowmoVolume.generated.h"
+
+class UBoxComponent;
+class USphereComponent;
+class UShapeComponent;
+class UPS_SlowmoVolumeSubsystem;
+
+UENUM(BlueprintType)
+enum class ESlowmoVolumeShape : uint8
+{
+	SPHERE = 0 UMETA(DisplayName = "Sphere"),
+	BOX = 1 UMETA(DisplayName = "Box"),
+};
+
+/**
+ * Region setting the time dilation of the actors and physic bodies inside it.
+ * Membership follows the shape overlap events, dilation itself is applied by UPS_SlowmoVolumeSubsystem once per frame.
+ * Overlapped components need GenerateOverlapEvents.
+ */
+UCLASS(Blueprintable)
+class PROJECTSLICE_API APS_SlowmoVolume : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	// Sets default values for this actor's properties
+	APS_SlowmoVolume();
+
+	virtual void OnConstruction(const FTransform& Transform) override;
+
+protected:
+	// Called when the game starts or when spawned
+	virtual void BeginPlay() override;
+
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+public:
+	UFUNCTION(BlueprintCallable)
+	void SetTimeDilation(const float newTimeDilation);
+
+	UFUNCTION(BlueprintCallable)
+	void SetPriority(const int32 newPriority);
+
+	FORCEINLINE float GetTimeDilation() const { return TimeDilation; }
+
+	FORCEINLINE int32 GetPriority() const { return Priority; }
+
+	UFUNCTION(BlueprintCallable)
+	UShapeComponent* GetActiveShape() const;
+
+protected:
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Components")
+	USphereComponent* SphereCollider;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Components")
+	UBoxComponent* BoxCollider;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Parameters")
+	ESlowmoVolumeShape Shape = ESlowmoVolumeShape::SPHERE;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Parameters", meta=(UIMin="0.01", ClampMin="0.01", UIMax="1", ToolTip="Custom time dilation of the actors inside"))
+	float TimeDilation = 0.3f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Parameters", meta=(ToolTip="Actor inside several volumes use the highest priority one, lowest dilation on tie"))
+	int32 Priority = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Parameters", meta=(ToolTip="Player dilation is driven by its slowmo component"))
+	bool bAffectPlayer = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Debug")
+	bool bDebug = false;
+
+private:
+	UFUNCTION()
+	void OnShapeBeginOverlap(UPrimitiveComponent* overlappedComponent, AActor* otherActor, UPrimitiveComponent* otherComp, int32 otherBodyIndex, bool bFromSweep, const FHitResult& sweepResult);
+
+	UFUNCTION()
+	void OnShapeEndOverlap(UPrimitiveComponent* overlappedComponent, AActor* otherActor, UPrimitiveComponent* otherComp, int32 otherBodyIndex);
+
+	bool CanAffect(const AActor* actor) const;
+
+	// Actor enter on its first overlapping component and leave on its last
+	void AddOverlap(AActor* actor);
+
+	void RemoveOverlap(AActor* actor);
+
+	// Members must be reapplied after a dilation or priority change
+	void MarkMembersDirty();
+
+	UPROPERTY(Transient)
+	UPS_SlowmoVolumeSubsystem* _SlowmoVolumeSubsystem;
+
+	TMap<TObjectKey<AActor>, int32> _OverlapCounts;
+};
@@ -4,6 +4,16 @@
 #include "PS_CanGenerateImpactField.h"
 #include "Components/ShapeComponent.h"
 #include "ProjectSlice/Components/GPE/PS_FieldSystemActor.h"
+#include "ProjectSlice/System/PS_ImpactFieldPoolSubsystem.h"
+
+namespace
+{
+	UPS_ImpactFieldPoolSubsystem* GetImpactFieldPool(const UObject* worldContext)
+	{
+		UWorld* world = IsValid(worldContext) ? worldContext->GetWorld() : nullptr;
+		return IsValid(world) ? world->GetSubsystem<UPS_ImpactFieldPoolSubsystem>() : nullptr;
+	}
+}
 
 void IPS_CanGenerateImpactField::ResetImpactField(const bool bForce)
 {
@@ -17,5 +27,39 @@ void IPS_CanGenerateImpactField::ResetImpactField(const bool bForce)
 		if(!overlappingActors.IsEmpty()) return;
 	}
 
-	GetImpactField()->Destroy();
+	ReleaseImpactField(GetImpactField());
+}
+
+void IPS_CanGenerateImpactField::PrewarmImpactFields(const int32 count)
+{
+	UPS_ImpactFieldPoolSubsystem* pool = GetImpactFieldPool(_getUObject());
+	if (!IsValid(pool)) return;
+
+	pool->PrewarmFields(GetFieldSystemClass(), count);
+}
+
+APS_FieldSystemActor* IPS_CanGenerateImpactField::AcquireImpactField(const FTransform& transform, AActor* owner)
+{
+	UPS_ImpactFieldPoolSubsystem* pool = GetImpactFieldPool(_getUObject());
+	if (!IsValid(pool)) return nullptr;
+
+	return pool->AcquireField(GetFieldSystemClass(), transform, _getUObject(), owner);
+}
+
+void IPS_CanGenerateImpactField::ReleaseImpactField(APS_FieldSystemActor* field)
+{
+	//Already returned (lifespan) or leased again by another implementer
+	if (!IsValid(field) || field->GetPoolUser() != _getUObject()) return;
+
+	UPS_ImpactFieldPoolSubsystem* pool = GetImpactFieldPool(_getUObject());
+	if (!IsValid(pool)) return;
+
+	//Unpooled field is destroyed as before the pool
+	if (!pool->ReleaseField(field)) field->Destroy();
+}
+
+bool IPS_CanGenerateImpactField::IsImpactFieldActive() const
+{
+	const APS_FieldSystemActor* field = GetImpactField();
+	return IsValid(field) && field->GetPoolUser() == _getUObject();
 }
@@ -36,6 +36,16 @@ public:
 
 	virtual void ResetImpactField(const bool bForce = false);
 
+	//Pool
+	void PrewarmImpactFields(const int32 count = 2);
+
+	APS_FieldSystemActor* AcquireImpactField(const FTransform& transform, AActor* owner);
+
+	void ReleaseImpactField(APS_FieldSystemActor* field);
+
+	// Field still leased by this implementer (can be returned to the pool by its lifespan)
+	bool IsImpactFieldActive() const;
+
 	virtual void UpdateImpactField(){};
 
 	//GeometryCollection event
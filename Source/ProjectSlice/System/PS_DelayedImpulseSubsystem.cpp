@@ -0,0 +1,83 @@
+#include "PS_DelayedImpulseSubsystem.h"
+
+#include "Components/MeshComponent.h"
+#include "Engine/World.h"
+#include "ProjectSlice/FunctionLibrary/PSFl.h"
+
+namespace
+{
+	struct FPSDelayedImpulseDeadlineLess
+	{
+		FORCEINLINE bool operator()(const FPSDelayedImpulse& A, const FPSDelayedImpulse& B) const { return A.Deadline < B.Deadline; }
+	};
+}
+
+bool UPS_DelayedImpulseSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UPS_DelayedImpulseSubsystem::Deinitialize()
+{
+	if (bDebug && !_PendingImpulses.IsEmpty()) UE_LOG(LogTemp, Warning, TEXT("%S :: %i impulses dropped"), __FUNCTION__, _PendingImpulses.Num());
+
+	_PendingImpulses.Empty();
+	OnImpulseApplied.Clear();
+
+	Super::Deinitialize();
+}
+
+void UPS_DelayedImpulseSubsystem::ScheduleImpulse(UMeshComponent* target, const FVector& impulse, const float delay, const float customDilation, UObject* instigator, const FVector& impactPoint, const FName boneName, const bool bVelChange)
+{
+	if (!IsValid(target) || !IsValid(GetWorld())) return;
+
+	const float safeDilation = customDilation > 0.0f ? customDilation : 1.0f;
+
+	FPSDelayedImpulse pending;
+	pending.Deadline = GetWorld()->GetRealTimeSeconds() + FMath::Max(delay, 0.0f) / safeDilation;
+	pending.Component = target;
+	pending.Instigator = instigator;
+	pending.Impulse = impulse;
+	pending.ImpactPoint = impactPoint;
+	pending.BoneName = boneName;
+	pending.bVelChange = bVelChange;
+
+	_PendingImpulses.HeapPush(MoveTemp(pending), FPSDelayedImpulseDeadlineLess());
+
+	if (bDebug) UE_LOG(LogTemp, Log, TEXT("%S :: %s in %fs, pending %i"), __FUNCTION__, *target->GetReadableName(), delay / safeDilation, _PendingImpulses.Num());
+}
+
+void UPS_DelayedImpulseSubsystem::CancelImpulses(const UObject* instigator)
+{
+	const int32 removedCount = _PendingImpulses.RemoveAll([instigator](const FPSDelayedImpulse& pending) { return pending.Instigator.Get() == instigator; });
+	if (removedCount > 0) _PendingImpulses.Heapify(FPSDelayedImpulseDeadlineLess());
+}
+
+void UPS_DelayedImpulseSubsystem::Tick(float DeltaTime)
+{
+	ApplyDueImpulses();
+}
+
+void UPS_DelayedImpulseSubsystem::ApplyDueImpulses()
+{
+	if (!IsValid(GetWorld())) return;
+
+	const double now = GetWorld()->GetRealTimeSeconds();
+	int32 appliedCount = 0;
+
+	//Impulse is popped before being applied, listeners can schedule new ones safely
+	while (!_PendingImpulses.IsEmpty() && _PendingImpulses.HeapTop().Deadline <= now)
+	{
+		FPSDelayedImpulse pending;
+		_PendingImpulses.HeapPop(pending, FPSDelayedImpulseDeadlineLess(), EAllowShrinking::No);
+
+		UMeshComponent* target = pending.Component.Get();
+		if (!IsValid(target)) continue;
+
+		UPSFl::AddImpulseDilated(target, target, pending.Impulse, pending.BoneName, pending.bVelChange);
+		OnImpulseApplied.Broadcast(pending.Instigator.Get(), target, pending.ImpactPoint);
+		appliedCount++;
+	}
+
+	if (bDebug && appliedCount > 0) UE_LOG(LogTemp, Log, TEXT("%S :: applied %i, pending %i"), __FUNCTION__, appliedCount, _PendingImpulses.Num());
+}
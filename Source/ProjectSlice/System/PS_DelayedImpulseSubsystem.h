@@ -0,0 +1,88 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Tickable.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PS_DelayedImpulseSubsystem.generated.h"
+
+class UMeshComponent;
+
+// Instigator, impulsed component, impact point
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnPSDelayedImpulseApplied, UObject*, UMeshComponent*, const FVector&);
+
+USTRUCT()
+struct FPSDelayedImpulse
+{
+	GENERATED_BODY()
+
+	// Real time deadline, delay already scaled by dilation
+	double Deadline = 0.0;
+
+	UPROPERTY(Transient)
+	TWeakObjectPtr<UMeshComponent> Component;
+
+	UPROPERTY(Transient)
+	TWeakObjectPtr<UObject> Instigator;
+
+	FVector Impulse = FVector::ZeroVector;
+
+	FVector ImpactPoint = FVector::ZeroVector;
+
+	FName BoneName = NAME_None;
+
+	bool bVelChange = false;
+};
+
+/**
+ * Delayed impulses of the whole world in one min heap ordered by real time deadline.
+ * Due impulses are applied in batch from a single tick through UPSFl::AddImpulseDilated, the subsystem only tick while impulses are pending.
+ */
+UCLASS()
+class PROJECTSLICE_API UPS_DelayedImpulseSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	virtual void Deinitialize() override;
+
+	/*
+	 * @brief Queue an impulse applied after delay / customDilation real time seconds
+	 * @param target: component to impulse, weak referenced
+	 * @param impulse: impulse given to UPSFl::AddImpulseDilated
+	 * @param delay: delay in dilated seconds
+	 * @param customDilation: dilation of the delay, 1 for real time
+	 * @param instigator: passed back in OnImpulseApplied
+	 * @param impactPoint: passed back in OnImpulseApplied
+	 */
+	void ScheduleImpulse(UMeshComponent* target, const FVector& impulse, const float delay, const float customDilation, UObject* instigator, const FVector& impactPoint, const FName boneName = NAME_None, const bool bVelChange = false);
+
+	// Drop every pending impulse of this instigator
+	void CancelImpulses(const UObject* instigator);
+
+	FORCEINLINE int32 GetPendingCount() const { return _PendingImpulses.Num(); }
+
+	FOnPSDelayedImpulseApplied OnImpulseApplied;
+
+protected:
+	bool bDebug = false;
+
+private:
+	void ApplyDueImpulses();
+
+	// Min heap on Deadline
+	UPROPERTY(Transient)
+	TArray<FPSDelayedImpulse> _PendingImpulses;
+
+#pragma region IntrerfaceTickableGameObject
+	//------------------
+
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return !_PendingImpulses.IsEmpty(); }
+	virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UPS_DelayedImpulseSubsystem, STATGROUP_Tickables); }
+	virtual UWorld* GetTickableGameObjectWorld() const override { return GetWorld(); }
+
+	//------------------
+#pragma endregion IntrerfaceTickableGameObject
+};
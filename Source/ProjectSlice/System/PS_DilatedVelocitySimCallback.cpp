@@ -0,0 +1,32 @@
+#include "PS_DilatedVelocitySimCallback.h"
+
+#include "PhysicsProxy/SingleParticlePhysicsProxy.h"
+
+void FPSDilatedVelocitySimCallback::OnPreSimulate_Internal()
+{
+	//Same input for every substep of the frame
+	const FPSDilatedVelocityInput* input = GetConsumerInput_Internal();
+	if (!input) return;
+
+	for (const FPSBodyVelocityLimit& limit : input->Bodies)
+	{
+		if (!limit.PhysicsHandle) continue;
+
+		Chaos::FRigidBodyHandle_Internal* rigidHandle = limit.PhysicsHandle->GetPhysicsThreadAPI();
+		if (!rigidHandle || rigidHandle->ObjectState() != Chaos::EObjectStateType::Dynamic) continue;
+
+		rigidHandle->SetV(ClampSpeed(rigidHandle->V(), limit.MinLinearSpeed, limit.MaxLinearSpeed));
+		rigidHandle->SetW(ClampSpeed(rigidHandle->W(), limit.MinAngularSpeed, limit.MaxAngularSpeed));
+	}
+}
+
+FVector FPSDilatedVelocitySimCallback::ClampSpeed(const FVector& velocity, const float minSpeed, const float maxSpeed)
+{
+	const float speed = velocity.Length();
+	if (speed <= MovingSpeedThreshold) return velocity;
+
+	float newSpeed = minSpeed > 0.0f ? FMath::Max(speed, minSpeed) : speed;
+	if (maxSpeed > 0.0f) newSpeed = FMath::Min(newSpeed, maxSpeed);
+
+	return newSpeed == speed ? velocity : velocity * (newSpeed / speed);
+}
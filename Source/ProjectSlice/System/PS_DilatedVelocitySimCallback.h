@@ -0,0 +1,48 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Chaos/SimCallbackInput.h"
+#include "Chaos/SimCallbackObject.h"
+#include "PhysicsInterfaceDeclaresCore.h"
+
+// Speed limits of one body, a limit <= 0 is ignored
+struct FPSBodyVelocityLimit
+{
+	FPhysicsActorHandle PhysicsHandle = nullptr;
+
+	// cm/s, applied only to a moving body
+	float MinLinearSpeed = 0.0f;
+
+	// cm/s
+	float MaxLinearSpeed = 0.0f;
+
+	// rad/s, applied only to a rotating body
+	float MinAngularSpeed = 0.0f;
+
+	// rad/s
+	float MaxAngularSpeed = 0.0f;
+};
+
+// Limits published by the game thread for the next physics steps
+struct FPSDilatedVelocityInput : public Chaos::FSimCallbackInput
+{
+	TArray<FPSBodyVelocityLimit> Bodies;
+
+	void Reset() { Bodies.Reset(); }
+};
+
+/**
+ * Clamp linear and angular speed of dilated bodies before each physics step (substeps included).
+ * Game thread fills one input per frame, nothing is read back so clamping costs no round trip to the physics scene.
+ */
+class PROJECTSLICE_API FPSDilatedVelocitySimCallback : public Chaos::TSimCallbackObject<FPSDilatedVelocityInput, Chaos::FSimCallbackNoOutput, Chaos::ESimCallbackOptions::Presimulate>
+{
+public:
+	virtual void OnPreSimulate_Internal() override;
+
+private:
+	// Rescale velocity length in [minSpeed, maxSpeed], unchanged under threshold
+	static FVector ClampSpeed(const FVector& velocity, const float minSpeed, const float maxSpeed);
+
+	static constexpr float MovingSpeedThreshold = KINDA_SMALL_NUMBER;
+};
@@ -0,0 +1,439 @@
+#include "PS_GeometryBenchmarkCommandlet.h"
+
+#include "HAL/LowLevelMemTracker.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "ProceduralMeshComponent.h"
+#include "Generators/SphereGenerator.h"
+#include "ProjectSlice/FunctionLibrary/PSFL_CustomProcMesh.h"
+#include "ProjectSlice/FunctionLibrary/PSFL_GeometryScript.h"
+#include "ProjectSlice/Components/GPE/PS_SlicedComponent.h"
+
+// Allocations of the measured calls, tracked per allocation by LLM (-LLM), whatever the thread freeing them
+LLM_DEFINE_TAG(PSGeometryBenchmark);
+
+namespace
+{
+    double Percentile(const TArray<double>& SortedValues, const double Ratio)
+    {
+        if (SortedValues.IsEmpty()) return 0.0;
+        const int32 Index = FMath::Clamp(FMath::CeilToInt(Ratio * SortedValues.Num()) - 1, 0, SortedValues.Num() - 1);
+        return SortedValues[Index];
+    }
+}
+
+UPS_GeometryBenchmarkCommandlet::UPS_GeometryBenchmarkCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = false;
+    LogToConsole = true;
+}
+
+int32 UPS_GeometryBenchmarkCommandlet::Main(const FString& Params)
+{
+    int32 TriangleCount = 20000;
+    int32 Iterations = 50;
+    float Threshold = 0.2f;
+    FString OutputPath = FPaths::ProjectSavedDir() / TEXT("Benchmark") / TEXT("GeometryScript.csv");
+    FString BaselinePath;
+
+    FParse::Value(*Params, TEXT("Triangles="), TriangleCount);
+    FParse::Value(*Params, TEXT("Iterations="), Iterations);
+    FParse::Value(*Params, TEXT("Threshold="), Threshold);
+    FParse::Value(*Params, TEXT("Output="), OutputPath);
+    FParse::Value(*Params, TEXT("Baseline="), BaselinePath);
+    bDebug = FParse::Param(*Params, TEXT("Debug"));
+
+    TriangleCount = FMath::Max(TriangleCount, 100);
+    Iterations = FMath::Max(Iterations, 1);
+
+    //Generated meshes, fixed for a given triangle count
+    TArray<TPair<FString, FDynamicMesh3>> Meshes;
+    GenerateSphere(TriangleCount, Meshes.Emplace_GetRef(TEXT("Sphere"), FDynamicMesh3()).Value);
+    GenerateTorus(TriangleCount, Meshes.Emplace_GetRef(TEXT("Torus"), FDynamicMesh3()).Value);
+    GenerateSeamBox(TriangleCount, Meshes.Emplace_GetRef(TEXT("SeamBox"), FDynamicMesh3()).Value);
+    GenerateSlicedFragment(TriangleCount, Meshes.Emplace_GetRef(TEXT("SlicedFragment"), FDynamicMesh3()).Value);
+
+    if (!FLowLevelMemTracker::IsEnabled()) UE_LOG(LogTemp, Warning, TEXT("%S :: LLM disabled, run with -LLM to measure retained memory"), __FUNCTION__);
+
+    TArray<FPSGeometryBenchmarkRow> Rows;
+    for (const TPair<FString, FDynamicMesh3>& Mesh : Meshes)
+    {
+        if (Mesh.Value.TriangleCount() == 0)
+        {
+            UE_LOG(LogTemp, Error, TEXT("%S :: %s generation failed"), __FUNCTION__, *Mesh.Key);
+            continue;
+        }
+        BenchmarkMesh(Mesh.Key, Mesh.Value, Iterations, Rows);
+    }
+
+    for (const FPSGeometryBenchmarkRow& Row : Rows)
+    {
+        UE_LOG(LogTemp, Display, TEXT("%S :: %-15s %-17s %7d tris | p50 %8.3f ms, p90 %8.3f ms, p99 %8.3f ms, max %8.3f ms | %10.1f KB retained"),
+            __FUNCTION__, *Row.MeshName, *Row.EntryPoint, Row.TriangleCount, Row.P50Ms, Row.P90Ms, Row.P99Ms, Row.MaxMs, Row.RetainedKB);
+    }
+
+    if (!SaveCsv(OutputPath, Rows))
+    {
+        UE_LOG(LogTemp, Error, TEXT("%S :: Failed to write %s"), __FUNCTION__, *OutputPath);
+        return 1;
+    }
+    UE_LOG(LogTemp, Display, TEXT("%S :: Results written to %s"), __FUNCTION__, *OutputPath);
+
+    if (BaselinePath.IsEmpty()) return 0;
+
+    TArray<FPSGeometryBenchmarkRow> BaselineRows;
+    if (!LoadCsv(BaselinePath, BaselineRows))
+    {
+        UE_LOG(LogTemp, Error, TEXT("%S :: Failed to read baseline %s"), __FUNCTION__, *BaselinePath);
+        return 1;
+    }
+
+    const int32 RegressionCount = CompareToBaseline(Rows, BaselineRows, Threshold);
+    if (RegressionCount > 0)
+    {
+        UE_LOG(LogTemp, Error, TEXT("%S :: %d metric(s) regressed by more than %.0f%%"), __FUNCTION__, RegressionCount, Threshold * 100.0f);
+        return 1;
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("%S :: No regression against %s"), __FUNCTION__, *BaselinePath);
+    return 0;
+}
+
+#pragma region Mesh
+//------------------
+
+void UPS_GeometryBenchmarkCommandlet::GenerateSphere(const int32 TriangleCount, FDynamicMesh3& OutMesh)
+{
+    FSphereGenerator SphereGenerator;
+    SphereGenerator.Radius = 100.0;
+    SphereGenerator.NumPhi = SphereGenerator.NumTheta = FMath::Max(3, FMath::RoundToInt(FMath::Sqrt(TriangleCount / 2.0)));
+    OutMesh.Copy(&SphereGenerator.Generate());
+}
+
+void UPS_GeometryBenchmarkCommandlet::GenerateTorus(const int32 TriangleCount, FDynamicMesh3& OutMesh)
+{
+    constexpr double MajorRadius = 100.0;
+    constexpr double MinorRadius = 30.0;
+
+    //Ring resolution 3x the tube resolution, 2 triangles per quad
+    const int32 NumMinor = FMath::Max(3, FMath::RoundToInt(FMath::Sqrt(TriangleCount / 6.0)));
+    const int32 NumMajor = NumMinor * 3;
+
+    OutMesh.Clear();
+    for (int32 i = 0; i < NumMajor; ++i)
+    {
+        const double Theta = UE_DOUBLE_TWO_PI * i / NumMajor;
+        for (int32 j = 0; j < NumMinor; ++j)
+        {
+            const double Phi = UE_DOUBLE_TWO_PI * j / NumMinor;
+            const double Ring = MajorRadius + MinorRadius * FMath::Cos(Phi);
+            OutMesh.AppendVertex(FVector3d(Ring * FMath::Cos(Theta), Ring * FMath::Sin(Theta), MinorRadius * FMath::Sin(Phi)));
+        }
+    }
+
+    for (int32 i = 0; i < NumMajor; ++i)
+    {
+        const int32 NextI = (i + 1) % NumMajor;
+        for (int32 j = 0; j < NumMinor; ++j)
+        {
+            const int32 NextJ = (j + 1) % NumMinor;
+            const int32 A = i * NumMinor + j;
+            const int32 B = NextI * NumMinor + j;
+            const int32 C = NextI * NumMinor + NextJ;
+            const int32 D = i * NumMinor + NextJ;
+            OutMesh.AppendTriangle(A, B, C);
+            OutMesh.AppendTriangle(A, C, D);
+        }
+    }
+}
+
+void UPS_GeometryBenchmarkCommandlet::GenerateSeamBox(const int32 TriangleCount, FDynamicMesh3& OutMesh)
+{
+    constexpr double HalfSize = 100.0;
+    const int32 Resolution = FMath::Max(1, FMath::RoundToInt(FMath::Sqrt(TriangleCount / 12.0)));
+
+    OutMesh.Clear();
+    for (int32 Axis = 0; Axis < 3; ++Axis)
+    {
+        for (const double Side : {-1.0, 1.0})
+        {
+            FVector3d Normal = FVector3d::ZeroVector;
+            Normal[Axis] = Side;
+            FVector3d TangentU = FVector3d::ZeroVector;
+            TangentU[(Axis + 1) % 3] = 1.0;
+            const FVector3d TangentV = Normal.Cross(TangentU);
+
+            //Face grid with its own vertices, duplicated along the box edges
+            const int32 BaseVID = OutMesh.MaxVertexID();
+            for (int32 v = 0; v <= Resolution; ++v)
+            {
+                for (int32 u = 0; u <= Resolution; ++u)
+                {
+                    const double U = 2.0 * u / Resolution - 1.0;
+                    const double V = 2.0 * v / Resolution - 1.0;
+                    OutMesh.AppendVertex((Normal + TangentU * U + TangentV * V) * HalfSize);
+                }
+            }
+
+            for (int32 v = 0; v < Resolution; ++v)
+            {
+                for (int32 u = 0; u < Resolution; ++u)
+                {
+                    const int32 A = BaseVID + v * (Resolution + 1) + u;
+                    const int32 B = A + 1;
+                    const int32 C = A + Resolution + 2;
+                    const int32 D = A + Resolution + 1;
+                    OutMesh.AppendTriangle(A, B, C);
+                    OutMesh.AppendTriangle(A, C, D);
+                }
+            }
+        }
+    }
+}
+
+void UPS_GeometryBenchmarkCommandlet::GenerateSlicedFragment(const int32 TriangleCount, FDynamicMesh3& OutMesh)
+{
+    FDynamicMesh3 Sphere;
+    GenerateSphere(TriangleCount, Sphere);
+
+    UProceduralMeshComponent* ProcMesh = CreateProcMesh(Sphere);
+    if (!IsValid(ProcMesh)) return;
+
+    //Same slicer and cap layout as the weapon without cap material
+    UPS_SlicedComponent* OtherHalf = nullptr;
+    FSCustomSliceOutput SliceOutput;
+    UPSFL_CustomProcMesh::SliceProcMesh(ProcMesh, FVector(0.0, 0.0, 30.0), FVector(0.3, 0.0, 1.0).GetSafeNormal(), false, nullptr, OtherHalf, SliceOutput, EProcMeshSliceCapOption::UseLastSectionForCap, nullptr);
+
+    UPSFL_GeometryScript::ConvertMeshComponentToDynamicMesh(ProcMesh, OutMesh);
+}
+
+UProceduralMeshComponent* UPS_GeometryBenchmarkCommandlet::CreateProcMesh(const FDynamicMesh3& Mesh)
+{
+    UProceduralMeshComponent* ProcMesh = NewObject<UProceduralMeshComponent>(this);
+    if (!IsValid(ProcMesh)) return nullptr;
+
+    //Generated meshes are compact, vertex IDs are buffer indices
+    TArray<FVector> Vertices;
+    Vertices.Reserve(Mesh.VertexCount());
+    for (const int32 VID : Mesh.VertexIndicesItr())
+    {
+        Vertices.Add(Mesh.GetVertex(VID));
+    }
+
+    TArray<int32> Triangles;
+    Triangles.Reserve(Mesh.TriangleCount() * 3);
+    for (const int32 TID : Mesh.TriangleIndicesItr())
+    {
+        const FIndex3i Triangle = Mesh.GetTriangle(TID);
+        Triangles.Append({Triangle.A, Triangle.B, Triangle.C});
+    }
+
+    ProcMesh->CreateMeshSection(0, Vertices, Triangles, TArray<FVector>(), TArray<FVector2D>(), TArray<FColor>(), TArray<FProcMeshTangent>(), false);
+    return ProcMesh;
+}
+
+//------------------
+#pragma endregion Mesh
+
+#pragma region Measure
+//------------------
+
+FPSGeometryBenchmarkRow UPS_GeometryBenchmarkCommandlet::Measure(const FString& MeshName, const FString& EntryPoint, const FDynamicMesh3& Mesh, const int32 Iterations, const TFunctionRef<void()>& Body) const
+{
+    FPSGeometryBenchmarkRow Row;
+    Row.MeshName = MeshName;
+    Row.EntryPoint = EntryPoint;
+    Row.TriangleCount = Mesh.TriangleCount();
+    Row.Iterations = Iterations;
+
+    //Warm up caches and lazy statics
+    Body();
+
+    TArray<double> Timings;
+    Timings.Reserve(Iterations);
+
+    const int64 StartBytes = GetTrackedBytes();
+    for (int32 i = 0; i < Iterations; ++i)
+    {
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        {
+            LLM_SCOPE_BYTAG(PSGeometryBenchmark);
+            Body();
+        }
+        const uint64 EndCycles = FPlatformTime::Cycles64();
+
+        Timings.Add(FPlatformTime::ToMilliseconds64(EndCycles - StartCycles));
+    }
+    const int64 RetainedBytes = GetTrackedBytes() - StartBytes;
+
+    Timings.Sort();
+    Row.P50Ms = Percentile(Timings, 0.5);
+    Row.P90Ms = Percentile(Timings, 0.9);
+    Row.P99Ms = Percentile(Timings, 0.99);
+    Row.MaxMs = Timings.Last();
+    Row.RetainedKB = static_cast<double>(RetainedBytes) / Iterations / 1024.0;
+
+    if (bDebug) UE_LOG(LogTemp, Log, TEXT("%S :: %s %s done"), __FUNCTION__, *MeshName, *EntryPoint);
+
+    return Row;
+}
+
+int64 UPS_GeometryBenchmarkCommandlet::GetTrackedBytes()
+{
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+    if (!FLowLevelMemTracker::IsEnabled()) return 0;
+
+    //Thread states are only summed into the tag amounts on update
+    FLowLevelMemTracker::Get().UpdateStatsPerFrame();
+    return FLowLevelMemTracker::Get().GetTagAmountForTracker(ELLMTracker::Default, TEXT("PSGeometryBenchmark"), ELLMTagSet::None);
+#else
+    return 0;
+#endif
+}
+
+void UPS_GeometryBenchmarkCommandlet::BenchmarkMesh(const FString& MeshName, const FDynamicMesh3& Mesh, const int32 Iterations, TArray<FPSGeometryBenchmarkRow>& OutRows)
+{
+    UProceduralMeshComponent* ProcMesh = CreateProcMesh(Mesh);
+    if (!IsValid(ProcMesh)) return;
+
+    //Fixed queries from the mesh bounds, on both sides of the mesh
+    const FAxisAlignedBox3d Bounds = Mesh.GetBounds();
+    const FVector Center = Bounds.Center();
+    const FVector Extents = Bounds.Extents();
+    const FVector StartPoint = Center + Extents * FVector(-1.05, 0.3, 0.3);
+    const FVector EndPoint = Center + Extents * FVector(1.05, -0.3, 0.3);
+    const FVector Velocity = FVector(0.0, 600.0, 0.0);
+    const FVector ViewDirection = FVector::ForwardVector;
+    const FTransform ComponentTransform = FTransform::Identity;
+
+    OutRows.Add(Measure(MeshName, TEXT("ConvertMesh"), Mesh, Iterations, [&]()
+    {
+        FDynamicMesh3 Converted;
+        UPSFL_GeometryScript::ConvertMeshComponentToDynamicMesh(ProcMesh, Converted);
+    }));
+
+    OutRows.Add(Measure(MeshName, TEXT("ClosestPoint"), Mesh, Iterations, [&]()
+    {
+        FVector NearestPoint;
+        UPSFL_GeometryScript::FindNearestPointOnMesh(Mesh, ComponentTransform, StartPoint, NearestPoint);
+    }));
+
+    OutRows.Add(Measure(MeshName, TEXT("Geodesic"), Mesh, Iterations, [&]()
+    {
+        TArray<FVector> Points;
+        UPSFL_GeometryScript::ComputeGeodesicPath(Mesh, ComponentTransform, StartPoint, EndPoint, Points);
+    }));
+
+    OutRows.Add(Measure(MeshName, TEXT("GeodesicVelocity"), Mesh, Iterations, [&]()
+    {
+        TArray<FVector> Points;
+        UPSFL_GeometryScript::ComputeGeodesicPathWithVelocity(Mesh, ComponentTransform, StartPoint, EndPoint, Velocity, Points);
+    }));
+
+    OutRows.Add(Measure(MeshName, TEXT("HullWidth"), Mesh, Iterations, [&]()
+    {
+        TArray<FVector> LocalHullPoints;
+        FHullWidthOutData Datas;
+        if (UPSFL_GeometryScript::ComputeConvexHullPoints(Mesh, LocalHullPoints))
+        {
+            UPSFL_GeometryScript::ComputeProjectedHullWidth(LocalHullPoints, ComponentTransform, ViewDirection, StartPoint, Datas);
+        }
+    }));
+}
+
+//------------------
+#pragma endregion Measure
+
+#pragma region Report
+//------------------
+
+bool UPS_GeometryBenchmarkCommandlet::SaveCsv(const FString& Path, const TArray<FPSGeometryBenchmarkRow>& Rows)
+{
+    FString Csv = TEXT("Mesh,EntryPoint,Triangles,Iterations,P50Ms,P90Ms,P99Ms,MaxMs,RetainedKB\n");
+    for (const FPSGeometryBenchmarkRow& Row : Rows)
+    {
+        Csv += FString::Printf(TEXT("%s,%s,%d,%d,%.4f,%.4f,%.4f,%.4f,%.2f\n"),
+            *Row.MeshName, *Row.EntryPoint, Row.TriangleCount, Row.Iterations, Row.P50Ms, Row.P90Ms, Row.P99Ms, Row.MaxMs, Row.RetainedKB);
+    }
+    return FFileHelper::SaveStringToFile(Csv, *Path);
+}
+
+bool UPS_GeometryBenchmarkCommandlet::LoadCsv(const FString& Path, TArray<FPSGeometryBenchmarkRow>& OutRows)
+{
+    TArray<FString> Lines;
+    if (!FFileHelper::LoadFileToStringArray(Lines, *Path)) return false;
+
+    OutRows.Reset();
+    for (int32 i = 1; i < Lines.Num(); ++i)
+    {
+        TArray<FString> Fields;
+        Lines[i].ParseIntoArray(Fields, TEXT(","));
+        if (Fields.Num() < 9) continue;
+
+        FPSGeometryBenchmarkRow& Row = OutRows.AddDefaulted_GetRef();
+        Row.MeshName = Fields[0];
+        Row.EntryPoint = Fields[1];
+        Row.TriangleCount = FCString::Atoi(*Fields[2]);
+        Row.Iterations = FCString::Atoi(*Fields[3]);
+        Row.P50Ms = FCString::Atod(*Fields[4]);
+        Row.P90Ms = FCString::Atod(*Fields[5]);
+        Row.P99Ms = FCString::Atod(*Fields[6]);
+        Row.MaxMs = FCString::Atod(*Fields[7]);
+        Row.RetainedKB = FCString::Atod(*Fields[8]);
+    }
+    return true;
+}
+
+int32 UPS_GeometryBenchmarkCommandlet::CompareToBaseline(const TArray<FPSGeometryBenchmarkRow>& Rows, const TArray<FPSGeometryBenchmarkRow>& BaselineRows, const double Threshold) const
+{
+    int32 RegressionCount = 0;
+
+    for (const FPSGeometryBenchmarkRow& Row : Rows)
+    {
+        const FPSGeometryBenchmarkRow* Baseline = BaselineRows.FindByPredicate([&Row](const FPSGeometryBenchmarkRow& Other)
+        {
+            return Other.MeshName == Row.MeshName && Other.EntryPoint == Row.EntryPoint;
+        });
+
+        if (!Baseline)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("%S :: %s %s missing from baseline"), __FUNCTION__, *Row.MeshName, *Row.EntryPoint);
+            continue;
+        }
+
+        if (Baseline->TriangleCount != Row.TriangleCount)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("%S :: %s %s baseline has %d triangles, got %d, skipped"), __FUNCTION__, *Row.MeshName, *Row.EntryPoint, Baseline->TriangleCount, Row.TriangleCount);
+            continue;
+        }
+
+        //Max is too noisy to gate on, it's only reported
+        const TPair<const TCHAR*, TTuple<double, double, double>> Metrics[] =
+        {
+            {TEXT("P50Ms"), MakeTuple(Row.P50Ms, Baseline->P50Ms, MinRegressionMs)},
+            {TEXT("P90Ms"), MakeTuple(Row.P90Ms, Baseline->P90Ms, MinRegressionMs)},
+            {TEXT("P99Ms"), MakeTuple(Row.P99Ms, Baseline->P99Ms, MinRegressionMs)},
+            {TEXT("RetainedKB"), MakeTuple(Row.RetainedKB, Baseline->RetainedKB, MinRegressionKB)},
+        };
+
+        for (const auto& Metric : Metrics)
+        {
+            const double Value = Metric.Value.Get<0>();
+            const double BaselineValue = Metric.Value.Get<1>();
+            const double MinDelta = Metric.Value.Get<2>();
+
+            if (Value - BaselineValue <= MinDelta || Value <= BaselineValue * (1.0 + Threshold)) continue;
+
+            ++RegressionCount;
+            UE_LOG(LogTemp, Error, TEXT("%S :: %s %s %s regressed %.3f -> %.3f (+%.0f%%)"), __FUNCTION__, *Row.MeshName, *Row.EntryPoint, Metric.Key,
+                BaselineValue, Value, BaselineValue > 0.0 ? (Value / BaselineValue - 1.0) * 100.0 : 100.0);
+        }
+    }
+
+    return RegressionCount;
+}
+
+//------------------
+#pragma endregion Report
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "DynamicMesh/DynamicMesh3.h"
+#include "PS_GeometryBenchmarkCommandlet.generated.h"
+
+class UProceduralMeshComponent;
+
+struct FPSGeometryBenchmarkRow
+{
+	FString MeshName;
+	FString EntryPoint;
+	int32 TriangleCount = 0;
+	int32 Iterations = 0;
+
+	double P50Ms = 0.0;
+	double P90Ms = 0.0;
+	double P99Ms = 0.0;
+	double MaxMs = 0.0;
+
+	// Per iteration, memory still held under the benchmark LLM tag once the calls are done (caches, leaks)
+	double RetainedKB = 0.0;
+};
+
+/**
+ * Headless benchmark of UPSFL_GeometryScript entry points on generated meshes (sphere, torus, box with seams, sliced fragment).
+ * Writes latency percentiles and retained memory (LLM tag, needs -LLM) to CSV and fails when a metric regresses past the threshold against a baseline CSV.
+ *
+ * UnrealEditor-Cmd ProjectSlice.uproject -run=PS_GeometryBenchmark -LLM [-Triangles=20000] [-Iterations=50] [-Output=<csv>] [-Baseline=<csv>] [-Threshold=0.2]
+ */
+UCLASS()
+class PROJECTSLICE_API UPS_GeometryBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UPS_GeometryBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+protected:
+	bool bDebug = false;
+
+private:
+#pragma region Mesh
+	//------------------
+
+	static void GenerateSphere(const int32 TriangleCount, FDynamicMesh3& OutMesh);
+
+	static void GenerateTorus(const int32 TriangleCount, FDynamicMesh3& OutMesh);
+
+	// Each face owns its vertices, like converted procedural sections
+	static void GenerateSeamBox(const int32 TriangleCount, FDynamicMesh3& OutMesh);
+
+	// Sphere sliced through the game slicer, cap merged in the same section
+	void GenerateSlicedFragment(const int32 TriangleCount, FDynamicMesh3& OutMesh);
+
+	UProceduralMeshComponent* CreateProcMesh(const FDynamicMesh3& Mesh);
+
+	//------------------
+#pragma endregion Mesh
+
+#pragma region Measure
+	//------------------
+
+	FPSGeometryBenchmarkRow Measure(const FString& MeshName, const FString& EntryPoint, const FDynamicMesh3& Mesh, const int32 Iterations, const TFunctionRef<void()>& Body) const;
+
+	// Bytes currently held under the benchmark LLM tag, 0 without LLM
+	static int64 GetTrackedBytes();
+
+	void BenchmarkMesh(const FString& MeshName, const FDynamicMesh3& Mesh, const int32 Iterations, TArray<FPSGeometryBenchmarkRow>& OutRows);
+
+	//------------------
+#pragma endregion Measure
+
+#pragma region Report
+	//------------------
+
+	static bool SaveCsv(const FString& Path, const TArray<FPSGeometryBenchmarkRow>& Rows);
+
+	static bool LoadCsv(const FString& Path, TArray<FPSGeometryBenchmarkRow>& OutRows);
+
+	// Returns the number of regressed metrics
+	int32 CompareToBaseline(const TArray<FPSGeometryBenchmarkRow>& Rows, const TArray<FPSGeometryBenchmarkRow>& BaselineRows, const double Threshold) const;
+
+	//------------------
+#pragma endregion Report
+
+	// Absolute deltas under these floors are considered noise
+	static constexpr double MinRegressionMs = 0.02;
+	static constexpr double MinRegressionKB = 1.0;
+};
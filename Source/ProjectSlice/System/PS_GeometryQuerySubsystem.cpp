@@ -0,0 +1,187 @@
+#include "PS_GeometryQuerySubsystem.h"
+
+#include "Async/Async.h"
+#include "ProjectSlice/Components/GPE/PS_SlicedComponent.h"
+
+void UPS_GeometryQuerySubsystem::Deinitialize()
+{
+    // Pending workers keep their own reference on the snapshots
+    ClearSnapshots();
+
+    Super::Deinitialize();
+}
+
+#pragma region Snapshot
+//------------------
+
+bool UPS_GeometryQuerySubsystem::CanCacheSnapshot(const UMeshComponent* MeshComponent)
+{
+    return IsValid(MeshComponent) && (MeshComponent->IsA<UPS_SlicedComponent>() || MeshComponent->IsA<UStaticMeshComponent>());
+}
+
+const UObject* UPS_GeometryQuerySubsystem::GetSourceAsset(const UMeshComponent* MeshComponent)
+{
+    if (const UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(MeshComponent))
+    {
+        return StaticMeshComponent->GetStaticMesh();
+    }
+    return nullptr;
+}
+
+FPSGeometrySnapshotPtr UPS_GeometryQuerySubsystem::GetSnapshot(UMeshComponent* MeshComponent)
+{
+    check(IsInGameThread());
+
+    if (!IsValid(MeshComponent)) return nullptr;
+
+    const uint32 MeshRevision = UPSFL_GeometryScript::GetMeshRevision(MeshComponent);
+    const UObject* SourceAsset = GetSourceAsset(MeshComponent);
+    const bool bCanCache = CanCacheSnapshot(MeshComponent);
+
+    //Reuse snapshot while the geometry didn't change
+    if (bCanCache)
+    {
+        if (const FSnapshotEntry* Entry = _Snapshots.Find(MeshComponent))
+        {
+            if (Entry->Snapshot.IsValid() && Entry->Snapshot->MeshRevision == MeshRevision && Entry->SourceAsset == SourceAsset) return Entry->Snapshot;
+        }
+    }
+
+    //Build new snapshot
+    TSharedPtr<FPSGeometrySnapshot, ESPMode::ThreadSafe> NewSnapshot = MakeShared<FPSGeometrySnapshot, ESPMode::ThreadSafe>();
+    if (!UPSFL_GeometryScript::ConvertMeshComponentToDynamicMesh(MeshComponent, NewSnapshot->Mesh))
+    {
+        if (bDebug) UE_LOG(LogTemp, Warning, TEXT("%S :: Failed to convert %s"), __FUNCTION__, *MeshComponent->GetName());
+        return nullptr;
+    }
+    NewSnapshot->MeshRevision = MeshRevision;
+
+    //Sliceables already cache their hull
+    if (UPS_SlicedComponent* SlicedComponent = Cast<UPS_SlicedComponent>(MeshComponent))
+    {
+        NewSnapshot->LocalHullPoints = SlicedComponent->GetConvexHullPoints();
+    }
+
+    if (bDebug) UE_LOG(LogTemp, Log, TEXT("%S :: %s revision %u, vertices %d"), __FUNCTION__, *MeshComponent->GetName(), MeshRevision, NewSnapshot->Mesh.VertexCount());
+
+    if (bCanCache)
+    {
+        if (!_Snapshots.Contains(MeshComponent)) PruneSnapshots();
+
+        FSnapshotEntry& Entry = _Snapshots.FindOrAdd(MeshComponent);
+        Entry.Snapshot = NewSnapshot;
+        Entry.SourceAsset = SourceAsset;
+    }
+
+    return NewSnapshot;
+}
+
+void UPS_GeometryQuerySubsystem::PruneSnapshots()
+{
+    for (auto It = _Snapshots.CreateIterator(); It; ++It)
+    {
+        if (!It.Key().IsValid()) It.RemoveCurrent();
+    }
+}
+
+void UPS_GeometryQuerySubsystem::ClearSnapshots()
+{
+    _Snapshots.Empty();
+}
+
+//------------------
+#pragma endregion Snapshot
+
+#pragma region Request
+//------------------
+
+TFuture<FPSGeodesicPathResult> UPS_GeometryQuerySubsystem::RequestGeodesicPath(UMeshComponent* MeshComponent, const FVector& StartPoint, const FVector& EndPoint, const FVector& Velocity, const float VelocityInfluence)
+{
+    const FPSGeometrySnapshotPtr Snapshot = GetSnapshot(MeshComponent);
+    if (!Snapshot.IsValid()) return MakeFulfilledPromise<FPSGeodesicPathResult>().GetFuture();
+
+    const FTransform ComponentTransform = MeshComponent->GetComponentTransform();
+    const TWeakObjectPtr<UMeshComponent> WeakMeshComponent = MeshComponent;
+    const bool bDebugQuery = bDebug;
+
+    return Async(EAsyncExecution::ThreadPool, [Snapshot, ComponentTransform, WeakMeshComponent, StartPoint, EndPoint, Velocity, VelocityInfluence, bDebugQuery]()
+    {
+        FPSGeodesicPathResult Result;
+
+        //Cache shared with the synchronous path, velocity biased paths aren't cached
+        const bool bUseCache = Velocity.IsNearlyZero();
+        const FPathCacheKey CacheKey = UPSFL_GeometryScript::MakePathCacheKey(StartPoint, EndPoint, WeakMeshComponent);
+        if (bUseCache && UPSFL_GeometryScript::TryGetCachedPath(CacheKey, Snapshot->MeshRevision, Result.Points))
+        {
+            Result.bSuccess = true;
+            return Result;
+        }
+
+        Result.bSuccess = UPSFL_GeometryScript::ComputeGeodesicPathWithVelocity(Snapshot->Mesh, ComponentTransform, StartPoint, EndPoint, Velocity, Result.Points, VelocityInfluence, bDebugQuery, nullptr, &Snapshot->GetSpatialIndex());
+
+        if (bUseCache && Result.bSuccess) UPSFL_GeometryScript::StoreCachedPath(CacheKey, Snapshot->MeshRevision, Result.Points);
+
+        return Result;
+    });
+}
+
+TFuture<FPSNearestPointResult> UPS_GeometryQuerySubsystem::RequestNearestPoint(UMeshComponent* MeshComponent, const FVector& Point)
+{
+    const FPSGeometrySnapshotPtr Snapshot = GetSnapshot(MeshComponent);
+    if (!Snapshot.IsValid()) return MakeFulfilledPromise<FPSNearestPointResult>().GetFuture();
+
+    const FTransform ComponentTransform = MeshComponent->GetComponentTransform();
+    const bool bDebugQuery = bDebug;
+
+    return Async(EAsyncExecution::ThreadPool, [Snapshot, ComponentTransform, Point, bDebugQuery]()
+    {
+        FPSNearestPointResult Result;
+        Result.bSuccess = UPSFL_GeometryScript::FindNearestPointOnMesh(Snapshot->Mesh, ComponentTransform, Point, Result.Point, bDebugQuery, &Snapshot->GetSpatialIndex());
+        return Result;
+    });
+}
+
+TFuture<FPSNearestPointsResult> UPS_GeometryQuerySubsystem::RequestNearestPoints(UMeshComponent* MeshComponent, const TArray<FVector>& Points)
+{
+    const FPSGeometrySnapshotPtr Snapshot = GetSnapshot(MeshComponent);
+    if (!Snapshot.IsValid()) return MakeFulfilledPromise<FPSNearestPointsResult>().GetFuture();
+
+    const FTransform ComponentTransform = MeshComponent->GetComponentTransform();
+
+    return Async(EAsyncExecution::ThreadPool, [Snapshot, ComponentTransform, Points]()
+    {
+        FPSNearestPointsResult Result;
+        Result.bSuccess = UPSFL_GeometryScript::ProjectPointsToMeshSurface(Snapshot->Mesh, ComponentTransform, Points, Result.Points, &Snapshot->GetSpatialIndex());
+        return Result;
+    });
+}
+
+TFuture<FPSHullWidthResult> UPS_GeometryQuerySubsystem::RequestHullWidth(UMeshComponent* MeshComponent, const FVector& ViewDirection, const FVector& SightHitPoint)
+{
+    const FPSGeometrySnapshotPtr Snapshot = GetSnapshot(MeshComponent);
+    if (!Snapshot.IsValid()) return MakeFulfilledPromise<FPSHullWidthResult>().GetFuture();
+
+    const FTransform ComponentTransform = MeshComponent->GetComponentTransform();
+
+    return Async(EAsyncExecution::ThreadPool, [Snapshot, ComponentTransform, ViewDirection, SightHitPoint]()
+    {
+        FPSHullWidthResult Result;
+
+        //Non sliceable meshes build their hull on the worker
+        if (!Snapshot->LocalHullPoints.IsEmpty())
+        {
+            Result.Width = UPSFL_GeometryScript::ComputeProjectedHullWidth(Snapshot->LocalHullPoints, ComponentTransform, ViewDirection, SightHitPoint, Result.Datas);
+            return Result;
+        }
+
+        TArray<FVector> LocalHullPoints;
+        if (UPSFL_GeometryScript::ComputeConvexHullPoints(Snapshot->Mesh, LocalHullPoints))
+        {
+            Result.Width = UPSFL_GeometryScript::ComputeProjectedHullWidth(LocalHullPoints, ComponentTransform, ViewDirection, SightHitPoint, Result.Datas);
+        }
+        return Result;
+    });
+}
+
+//------------------
+#pragma endregion Request
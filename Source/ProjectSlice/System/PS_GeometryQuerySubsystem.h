@@ -0,0 +1,107 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DynamicMesh/DynamicMesh3.h"
+#include "ProjectSlice/FunctionLibrary/PSFL_GeometryScript.h"
+#include "PS_GeometryQuerySubsystem.generated.h"
+
+// Immutable copy of a mesh geometry, shared between the game thread and the query workers
+struct FPSGeometrySnapshot
+{
+	FDynamicMesh3 Mesh;
+
+	// Component space hull points, empty when the hull has to be built by the worker
+	TArray<FVector> LocalHullPoints;
+
+	uint32 MeshRevision = 0;
+
+	// Built by the first worker that needs it, then shared by every query on this snapshot
+	const FPSMeshSpatialIndex& GetSpatialIndex() const
+	{
+		FScopeLock Lock(&SpatialIndexLock);
+		if (!SpatialIndex.IsBuilt()) SpatialIndex.Build(Mesh);
+		return SpatialIndex;
+	}
+
+private:
+	mutable FPSMeshSpatialIndex SpatialIndex;
+	
+	mutable FCriticalSection SpatialIndexLock;
+};
+
+using FPSGeometrySnapshotPtr = TSharedPtr<const FPSGeometrySnapshot, ESPMode::ThreadSafe>;
+
+struct FPSGeodesicPathResult
+{
+	bool bSuccess = false;
+	TArray<FVector> Points;
+};
+
+struct FPSNearestPointResult
+{
+	bool bSuccess = false;
+	FVector Point = FVector::ZeroVector;
+};
+
+struct FPSNearestPointsResult
+{
+	bool bSuccess = false;
+	TArray<FVector> Points;
+};
+
+struct FPSHullWidthResult
+{
+	float Width = 0.0f;
+	FHullWidthOutData Datas;
+};
+
+/**
+ * Runs geometry queries (geodesic path, nearest point, projected hull width) on worker threads.
+ * Requests are issued on the game thread, the mesh is snapshotted once per geometry revision and
+ * workers only read that snapshot. Callers poll the returned future and keep their last result meanwhile.
+ */
+UCLASS()
+class PROJECTSLICE_API UPS_GeometryQuerySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	TFuture<FPSGeodesicPathResult> RequestGeodesicPath(UMeshComponent* MeshComponent, const FVector& StartPoint, const FVector& EndPoint, const FVector& Velocity = FVector::ZeroVector, const float VelocityInfluence = 0.5f);
+
+	TFuture<FPSNearestPointResult> RequestNearestPoint(UMeshComponent* MeshComponent, const FVector& Point);
+
+	// Projects all points in one pass over the snapshot spatial index (e.g. intermediate cable points)
+	TFuture<FPSNearestPointsResult> RequestNearestPoints(UMeshComponent* MeshComponent, const TArray<FVector>& Points);
+
+	TFuture<FPSHullWidthResult> RequestHullWidth(UMeshComponent* MeshComponent, const FVector& ViewDirection, const FVector& SightHitPoint);
+
+	// Game thread only, returns the cached snapshot or builds a new one if the geometry changed
+	FPSGeometrySnapshotPtr GetSnapshot(UMeshComponent* MeshComponent);
+
+	void ClearSnapshots();
+
+	// Worker queries log and draw, set from blueprint through the world subsystem
+	UPROPERTY(Transient, BlueprintReadWrite, Category="Debug")
+	bool bDebug = false;
+
+private:
+	struct FSnapshotEntry
+	{
+		FPSGeometrySnapshotPtr Snapshot;
+
+		// Static mesh asset the snapshot was built from, only compared
+		const UObject* SourceAsset = nullptr;
+	};
+
+	// Only sliceables and static meshes expose a reliable revision, other meshes are snapshotted on each request
+	static bool CanCacheSnapshot(const UMeshComponent* MeshComponent);
+
+	static const UObject* GetSourceAsset(const UMeshComponent* MeshComponent);
+
+	void PruneSnapshots();
+
+	TMap<TWeakObjectPtr<UMeshComponent>, FSnapshotEntry> _Snapshots;
+};
@@ -0,0 +1,173 @@
+#include "PS_ImpactFieldPoolSubsystem.h"
+
+#include "Engine/World.h"
+#include "TimerManager.h"
+#include "GameFramework/Pawn.h"
+#include "ProjectSlice/Components/GPE/PS_FieldSystemActor.h"
+
+bool UPS_ImpactFieldPoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UPS_ImpactFieldPoolSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	InWorld.GetTimerManager().SetTimer(_LeakCheckTimerHandle, FTimerDelegate::CreateUObject(this, &UPS_ImpactFieldPoolSubsystem::CheckLeaks), LeakCheckInterval, true);
+}
+
+void UPS_ImpactFieldPoolSubsystem::Deinitialize()
+{
+	if (IsValid(GetWorld())) GetWorld()->GetTimerManager().ClearTimer(_LeakCheckTimerHandle);
+
+	//Fields never returned before level end
+	for (const TPair<TObjectPtr<APS_FieldSystemActor>, FPSImpactFieldLease>& lease : _Leases)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("%S :: field %s leaked, user %s"), __FUNCTION__, *GetNameSafe(lease.Key), *GetNameSafe(lease.Value.User.Get()));
+	}
+
+	if (bDebug) UE_LOG(LogTemp, Log, TEXT("%S :: hit %i, miss %i"), __FUNCTION__, _HitCount, _MissCount);
+
+	_Leases.Empty();
+	_FreeFields.Empty();
+
+	Super::Deinitialize();
+}
+
+void UPS_ImpactFieldPoolSubsystem::PrewarmFields(const TSubclassOf<APS_FieldSystemActor>& fieldClass, const int32 count)
+{
+	if (!IsValid(fieldClass.Get()) || !IsValid(GetWorld())) return;
+
+	//Prewarmed field would run its BeginPlay at the origin, pool fills with its first uses instead
+	if (ReplaysBeginPlay(fieldClass))
+	{
+		if (bDebug) UE_LOG(LogTemp, Log, TEXT("%S :: %s acts in BeginPlay, not prewarmed"), __FUNCTION__, *GetNameSafe(fieldClass.Get()));
+		return;
+	}
+
+	FPSImpactFieldFreeList& freeList = _FreeFields.FindOrAdd(fieldClass.Get());
+	freeList.Fields.Reserve(count);
+	while (freeList.Fields.Num() < count)
+	{
+		APS_FieldSystemActor* field = SpawnField(fieldClass, FTransform::Identity, nullptr, true);
+		if (!IsValid(field)) return;
+
+		freeList.Fields.Add(field);
+	}
+
+	if (bDebug) UE_LOG(LogTemp, Log, TEXT("%S :: %s x%i"), __FUNCTION__, *GetNameSafe(fieldClass.Get()), freeList.Fields.Num());
+}
+
+APS_FieldSystemActor* UPS_ImpactFieldPoolSubsystem::AcquireField(const TSubclassOf<APS_FieldSystemActor>& fieldClass, const FTransform& transform, UObject* user, AActor* owner)
+{
+	if (!IsValid(fieldClass.Get()) || !IsValid(GetWorld())) return nullptr;
+
+	//Free list can hold fields destroyed by level streaming
+	APS_FieldSystemActor* field = nullptr;
+	FPSImpactFieldFreeList& freeList = _FreeFields.FindOrAdd(fieldClass.Get());
+	while (!IsValid(field) && !freeList.Fields.IsEmpty())
+	{
+		field = freeList.Fields.Pop(EAllowShrinking::No);
+	}
+
+	const bool bReplaysBeginPlay = ReplaysBeginPlay(fieldClass);
+	const bool bIsReused = IsValid(field);
+	if (bIsReused) _HitCount++;
+	else
+	{
+		field = SpawnField(fieldClass, transform, owner, !bReplaysBeginPlay);
+		_MissCount++;
+		if (bDebug) UE_LOG(LogTemp, Warning, TEXT("%S :: pool empty for %s, spawned"), __FUNCTION__, *GetNameSafe(fieldClass.Get()));
+	}
+
+	if (!IsValid(field)) return nullptr;
+
+	FPSImpactFieldLease& lease = _Leases.Add(field);
+	lease.User = user;
+	lease.AcquireTime = GetWorld()->GetTimeSeconds();
+
+	field->SetOwner(owner);
+	field->SetInstigator(Cast<APawn>(owner));
+	//Spawned field of a BeginPlay class already ran its BeginPlay at transform for this use
+	if (!bIsReused && bReplaysBeginPlay) field->SetPoolUser(user);
+	else field->OnAcquiredFromPool(transform, user, bReplaysBeginPlay);
+
+	return field;
+}
+
+bool UPS_ImpactFieldPoolSubsystem::ReleaseField(APS_FieldSystemActor* field)
+{
+	if (!IsValid(field) || _Leases.Remove(field) == 0) return false;
+
+	field->OnReleasedToPool();
+	_FreeFields.FindOrAdd(field->GetClass()).Fields.Add(field);
+
+	if (bDebug) UE_LOG(LogTemp, Log, TEXT("%S :: %s, leased %i"), __FUNCTION__, *field->GetName(), _Leases.Num());
+
+	return true;
+}
+
+bool UPS_ImpactFieldPoolSubsystem::ReplaysBeginPlay(const TSubclassOf<APS_FieldSystemActor>& fieldClass)
+{
+	const APS_FieldSystemActor* fieldCDO = fieldClass.GetDefaultObject();
+	return IsValid(fieldCDO) && fieldCDO->ReplaysBeginPlay();
+}
+
+APS_FieldSystemActor* UPS_ImpactFieldPoolSubsystem::SpawnField(const TSubclassOf<APS_FieldSystemActor>& fieldClass, const FTransform& transform, AActor* owner, const bool bDormant)
+{
+	FActorSpawnParameters spawnInfo;
+	spawnInfo.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	spawnInfo.Owner = owner;
+	spawnInfo.Instigator = Cast<APawn>(owner);
+
+	APS_FieldSystemActor* field = GetWorld()->SpawnActor<APS_FieldSystemActor>(fieldClass.Get(), transform, spawnInfo);
+	if (!IsValid(field)) return nullptr;
+
+	field->OnDestroyed.AddUniqueDynamic(this, &UPS_ImpactFieldPoolSubsystem::OnFieldDestroyed);
+	if (bDormant) field->OnReleasedToPool();
+
+	return field;
+}
+
+void UPS_ImpactFieldPoolSubsystem::OnFieldDestroyed(AActor* destroyedActor)
+{
+	APS_FieldSystemActor* field = Cast<APS_FieldSystemActor>(destroyedActor);
+	if (!field) return;
+
+	_Leases.Remove(field);
+	if (FPSImpactFieldFreeList* freeList = _FreeFields.Find(field->GetClass()))
+	{
+		freeList->Fields.RemoveSingleSwap(field, EAllowShrinking::No);
+	}
+}
+
+void UPS_ImpactFieldPoolSubsystem::CheckLeaks()
+{
+	if (_Leases.IsEmpty() || !IsValid(GetWorld())) return;
+
+	const double now = GetWorld()->GetTimeSeconds();
+	TArray<APS_FieldSystemActor*, TInlineAllocator<4>> orphanFields;
+
+	for (TPair<TObjectPtr<APS_FieldSystemActor>, FPSImpactFieldLease>& lease : _Leases)
+	{
+		//User destroyed, nobody can return this field anymore
+		if (!lease.Value.User.IsValid())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("%S :: field %s leaked, user destroyed"), __FUNCTION__, *GetNameSafe(lease.Key));
+			if (bReclaimOrphanFields) orphanFields.Add(lease.Key);
+			continue;
+		}
+
+		if (!lease.Value.bLeakReported && now - lease.Value.AcquireTime > LeakTimeout)
+		{
+			lease.Value.bLeakReported = true;
+			UE_LOG(LogTemp, Warning, TEXT("%S :: field %s leased by %s since %.1fs"), __FUNCTION__, *GetNameSafe(lease.Key), *GetNameSafe(lease.Value.User.Get()), now - lease.Value.AcquireTime);
+		}
+	}
+
+	for (APS_FieldSystemActor* field : orphanFields)
+	{
+		ReleaseField(field);
+	}
+}
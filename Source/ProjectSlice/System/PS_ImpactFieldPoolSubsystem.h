@@ -0,0 +1,98 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PS_ImpactFieldPoolSubsystem.generated.h"
+
+class APS_FieldSystemActor;
+
+USTRUCT()
+struct FPSImpactFieldFreeList
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<APS_FieldSystemActor>> Fields;
+};
+
+USTRUCT()
+struct FPSImpactFieldLease
+{
+	GENERATED_BODY()
+
+	// Object which acquired the field (component implementing IPS_CanGenerateImpactField)
+	UPROPERTY(Transient)
+	TWeakObjectPtr<UObject> User;
+
+	UPROPERTY(Transient)
+	double AcquireTime = 0.0;
+
+	UPROPERTY(Transient)
+	bool bLeakReported = false;
+};
+
+/**
+ * Pool of chaos impact field actors, one free list per field class.
+ * Fields are spawned hidden at level start (prewarm), handed out with a transform and returned instead of destroyed
+ * (ReleaseField, lifespan expiry or DestroyActor from blueprint). Leases are checked periodically to report fields never returned.
+ */
+UCLASS()
+class PROJECTSLICE_API UPS_ImpactFieldPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	virtual void Deinitialize() override;
+
+	// Spawn fields of this class until the free list hold count of them
+	void PrewarmFields(const TSubclassOf<APS_FieldSystemActor>& fieldClass, const int32 count);
+
+	// Pop a free field (spawn one if the list is empty) and activate it at transform
+	APS_FieldSystemActor* AcquireField(const TSubclassOf<APS_FieldSystemActor>& fieldClass, const FTransform& transform, UObject* user, AActor* owner);
+
+	// Return false if the field isn't currently leased by the pool
+	bool ReleaseField(APS_FieldSystemActor* field);
+
+	// Classes activating in blueprint BeginPlay aren't prewarmed, their first fields are spawned at use and BeginPlay is replayed on reuse
+	static bool ReplaysBeginPlay(const TSubclassOf<APS_FieldSystemActor>& fieldClass);
+
+	FORCEINLINE bool IsFieldLeased(const APS_FieldSystemActor* field) const { return _Leases.Contains(field); }
+
+	FORCEINLINE int32 GetLeasedCount() const { return _Leases.Num(); }
+
+protected:
+	bool bDebug = false;
+
+	// Leased longer than this a field is reported as leaked
+	static constexpr double LeakTimeout = 30.0;
+
+	static constexpr float LeakCheckInterval = 5.0f;
+
+	// Leak whose user is destroyed is returned to the pool, long leases are only reported
+	static constexpr bool bReclaimOrphanFields = true;
+
+private:
+	// Dormant field is hidden until acquired, an active one runs its BeginPlay at transform for the current use
+	APS_FieldSystemActor* SpawnField(const TSubclassOf<APS_FieldSystemActor>& fieldClass, const FTransform& transform, AActor* owner, const bool bDormant);
+
+	UFUNCTION()
+	void OnFieldDestroyed(AActor* destroyedActor);
+
+	void CheckLeaks();
+
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<UClass>, FPSImpactFieldFreeList> _FreeFields;
+
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<APS_FieldSystemActor>, FPSImpactFieldLease> _Leases;
+
+	FTimerHandle _LeakCheckTimerHandle;
+
+	int32 _HitCount = 0;
+
+	int32 _MissCount = 0;
+};
@@ -0,0 +1,170 @@
+#include "PS_SlowmoVolumeSubsystem.h"
+
+#include "Engine/World.h"
+#include "Kismet/GameplayStatics.h"
+#include "ProjectSlice/Character/PC/PS_Character.h"
+#include "ProjectSlice/Components/PC/PS_SlowmoComponent.h"
+#include "ProjectSlice/GPE/PS_SlowmoVolume.h"
+#include "ProjectSlice/System/PS_TimerSubsystem.h"
+
+bool UPS_SlowmoVolumeSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UPS_SlowmoVolumeSubsystem::Deinitialize()
+{
+	_Members.Empty();
+	_DirtyActors.Empty();
+	_PlayerSlowmoComponent.Reset();
+
+	Super::Deinitialize();
+}
+
+void UPS_SlowmoVolumeSubsystem::EnterVolume(APS_SlowmoVolume* volume, AActor* actor)
+{
+	if (!IsValid(volume) || !IsValid(actor)) return;
+
+	FPSSlowmoVolumeMember* existingMember = _Members.Find(actor);
+	FPSSlowmoVolumeMember& member = existingMember ? *existingMember : _Members.Add(actor);
+	if (!existingMember) CaptureEnterSpeeds(actor, member);
+	member.Actor = actor;
+	member.Volumes.AddUnique(volume);
+
+	_DirtyActors.Add(actor);
+}
+
+void UPS_SlowmoVolumeSubsystem::LeaveVolume(const APS_SlowmoVolume* volume, AActor* actor)
+{
+	FPSSlowmoVolumeMember* member = _Members.Find(actor);
+	if (!member) return;
+
+	//Destroyed volumes are dropped too
+	member->Volumes.RemoveAllSwap([volume](const TWeakObjectPtr<APS_SlowmoVolume>& volumePtr) { return !volumePtr.IsValid() || volumePtr.Get() == volume; }, EAllowShrinking::No);
+	_DirtyActors.Add(actor);
+}
+
+void UPS_SlowmoVolumeSubsystem::MarkActorDirty(AActor* actor)
+{
+	if (_Members.Contains(actor)) _DirtyActors.Add(actor);
+}
+
+float UPS_SlowmoVolumeSubsystem::GetVolumeDilation(const AActor* actor) const
+{
+	const FPSSlowmoVolumeMember* member = _Members.Find(actor);
+	return member ? ComputeVolumeDilation(*member) : 1.0f;
+}
+
+void UPS_SlowmoVolumeSubsystem::Tick(float DeltaTime)
+{
+	ApplyDirtyMembers();
+}
+
+void UPS_SlowmoVolumeSubsystem::ApplyDirtyMembers()
+{
+	const UPS_SlowmoComponent* slowmoComponent = GetPlayerSlowmoComponent();
+	int32 appliedCount = 0;
+
+	for (const TObjectKey<AActor>& actorKey : _DirtyActors)
+	{
+		FPSSlowmoVolumeMember* member = _Members.Find(actorKey);
+		if (!member) continue;
+
+		AActor* actor = member->Actor.Get();
+		const float targetDilation = ComputeVolumeDilation(*member);
+		const float maxLinearSpeed = member->EnterLinearSpeed * targetDilation;
+		const float maxAngularSpeed = member->EnterAngularSpeed * targetDilation;
+
+		//Left every volume or destroyed
+		if (!IsValid(actor) || member->Volumes.IsEmpty()) _Members.Remove(actorKey);
+		if (!IsValid(actor) || actor->IsActorBeingDestroyed()) continue;
+
+		//Slowmo component owns its dilated actors until it releases them
+		if (IsValid(slowmoComponent) && slowmoComponent->GetDilatedActors().Find(actor) != INDEX_NONE) continue;
+
+		const float currentDilation = actor->CustomTimeDilation;
+		if (FMath::IsNearlyEqual(currentDilation, targetDilation)) continue;
+
+		actor->CustomTimeDilation = targetDilation;
+		if (currentDilation > KINDA_SMALL_NUMBER) RescalePhysicsVelocity(actor, targetDilation / currentDilation, maxLinearSpeed, maxAngularSpeed);
+		appliedCount++;
+
+		if (bDebug) UE_LOG(LogTemp, Log, TEXT("%S :: %s dilation %f -> %f"), __FUNCTION__, *actor->GetActorNameOrLabel(), currentDilation, targetDilation);
+	}
+	_DirtyActors.Reset();
+
+	if (appliedCount == 0) return;
+
+	if (UPS_TimerSubsystem* timerSubsystem = UPS_TimerSubsystem::Get(this)) timerSubsystem->NotifyTimeDilationChanged();
+}
+
+float UPS_SlowmoVolumeSubsystem::ComputeVolumeDilation(const FPSSlowmoVolumeMember& member)
+{
+	const APS_SlowmoVolume* bestVolume = nullptr;
+	for (const TWeakObjectPtr<APS_SlowmoVolume>& volumePtr : member.Volumes)
+	{
+		const APS_SlowmoVolume* volume = volumePtr.Get();
+		if (!IsValid(volume)) continue;
+
+		if (!bestVolume
+			|| volume->GetPriority() > bestVolume->GetPriority()
+			|| (volume->GetPriority() == bestVolume->GetPriority() && volume->GetTimeDilation() < bestVolume->GetTimeDilation()))
+		{
+			bestVolume = volume;
+		}
+	}
+
+	return bestVolume ? bestVolume->GetTimeDilation() : 1.0f;
+}
+
+void UPS_SlowmoVolumeSubsystem::CaptureEnterSpeeds(const AActor* actor, FPSSlowmoVolumeMember& member)
+{
+	const float dilation = FMath::Max(actor->CustomTimeDilation, KINDA_SMALL_NUMBER);
+
+	const TInlineComponentArray<UPrimitiveComponent*> primitives(actor);
+	for (const UPrimitiveComponent* primitive : primitives)
+	{
+		if (!IsValid(primitive) || !primitive->IsSimulatingPhysics()) continue;
+
+		member.EnterLinearSpeed = FMath::Max(member.EnterLinearSpeed, primitive->GetPhysicsLinearVelocity().Length() / dilation);
+		member.EnterAngularSpeed = FMath::Max(member.EnterAngularSpeed, primitive->GetPhysicsAngularVelocityInRadians().Length() / dilation);
+	}
+}
+
+void UPS_SlowmoVolumeSubsystem::RescalePhysicsVelocity(AActor* actor, const float ratio, const float maxLinearSpeed, const float maxAngularSpeed)
+{
+	const TInlineComponentArray<UPrimitiveComponent*> primitives(actor);
+	for (UPrimitiveComponent* primitive : primitives)
+	{
+		if (!IsValid(primitive) || !primitive->IsSimulatingPhysics()) continue;
+
+		FVector linearVelocity = primitive->GetPhysicsLinearVelocity();
+		FVector angularVelocity = primitive->GetPhysicsAngularVelocityInRadians();
+
+		//Speed gained from gravity inside the volume isn't multiplied on exit
+		if (ratio > 1.0f)
+		{
+			linearVelocity = (linearVelocity * ratio).GetClampedToMaxSize(FMath::Max(linearVelocity.Length(), maxLinearSpeed));
+			angularVelocity = (angularVelocity * ratio).GetClampedToMaxSize(FMath::Max(angularVelocity.Length(), maxAngularSpeed));
+		}
+		else
+		{
+			linearVelocity *= ratio;
+			angularVelocity *= ratio;
+		}
+
+		primitive->SetPhysicsLinearVelocity(linearVelocity);
+		primitive->SetPhysicsAngularVelocityInRadians(angularVelocity);
+	}
+}
+
+UPS_SlowmoComponent* UPS_SlowmoVolumeSubsystem::GetPlayerSlowmoComponent()
+{
+	if (!_PlayerSlowmoComponent.IsValid() && IsValid(GetWorld()))
+	{
+		const AProjectSliceCharacter* playerCharacter = Cast<AProjectSliceCharacter>(UGameplayStatics::GetPlayerCharacter(GetWorld(), 0));
+		if (IsValid(playerCharacter)) _PlayerSlowmoComponent = playerCharacter->GetSlowmoComponent();
+	}
+
+	return _PlayerSlowmoComponent.Get();
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Tickable.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "PS_SlowmoVolumeSubsystem.generated.h"
+
+class APS_SlowmoVolume;
+class UPS_SlowmoComponent;
+
+USTRUCT()
+struct FPSSlowmoVolumeMember
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	TWeakObjectPtr<AActor> Actor;
+
+	// Volumes currently overlapping the actor
+	TArray<TWeakObjectPtr<APS_SlowmoVolume>, TInlineAllocator<2>> Volumes;
+
+	// Simulating bodies highest speeds on enter, at dilation 1
+	float EnterLinearSpeed = 0.0f;
+
+	float EnterAngularSpeed = 0.0f;
+};
+
+/**
+ * Membership of actors in slowmo volumes, updated from the volumes overlap events.
+ * Changed actors are queued and their custom time dilation applied in one pass on the next tick, the subsystem only tick while actors are queued.
+ * Actors dilated by the player slowmo component keep its dilation and fall back to their volume dilation when released.
+ */
+UCLASS()
+class PROJECTSLICE_API UPS_SlowmoVolumeSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	virtual void Deinitialize() override;
+
+	void EnterVolume(APS_SlowmoVolume* volume, AActor* actor);
+
+	void LeaveVolume(const APS_SlowmoVolume* volume, AActor* actor);
+
+	// Queue actor dilation for the next pass
+	void MarkActorDirty(AActor* actor);
+
+	// Dilation given by the volumes overlapping actor, 1 outside of any volume
+	float GetVolumeDilation(const AActor* actor) const;
+
+	FORCEINLINE int32 GetMemberCount() const { return _Members.Num(); }
+
+protected:
+	bool bDebug = false;
+
+private:
+	void ApplyDirtyMembers();
+
+	// Highest priority volume, lowest dilation on tie
+	static float ComputeVolumeDilation(const FPSSlowmoVolumeMember& member);
+
+	// Enter speeds of the simulating bodies of the actor, normalized by its current dilation
+	static void CaptureEnterSpeeds(const AActor* actor, FPSSlowmoVolumeMember& member);
+
+	// Chaos doesn't use custom time dilation, simulating bodies velocity follow the dilation ratio.
+	// Gravity isn't dilated, sped up bodies are clamped to their enter speed at the target dilation (or kept at their current speed when faster)
+	static void RescalePhysicsVelocity(AActor* actor, const float ratio, const float maxLinearSpeed, const float maxAngularSpeed);
+
+	UPS_SlowmoComponent* GetPlayerSlowmoComponent();
+
+	// Members are weak referenced, no GC reference needed
+	TMap<TObjectKey<AActor>, FPSSlowmoVolumeMember> _Members;
+
+	TSet<TObjectKey<AActor>> _DirtyActors;
+
+	TWeakObjectPtr<UPS_SlowmoComponent> _PlayerSlowmoComponent;
+
+#pragma region IntrerfaceTickableGameObject
+	//------------------
+
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return !_DirtyActors.IsEmpty(); }
+	virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UPS_SlowmoVolumeSubsystem, STATGROUP_Tickables); }
+	virtual UWorld* GetTickableGameObjectWorld() const override { return GetWorld(); }
+
+	//------------------
+#pragma endregion IntrerfaceTickableGameObject
+};
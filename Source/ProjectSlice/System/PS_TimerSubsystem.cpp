@@ -1,124 +1,231 @@
 #include "PS_TimerSubsystem.h"
+#include "Engine/GameInstance.h"
 #include "Engine/World.h"
+#include "Kismet/GameplayStatics.h"
+
+UPS_TimerSubsystem* UPS_TimerSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = IsValid(WorldContextObject) ? WorldContextObject->GetWorld() : nullptr;
+    const UGameInstance* GameInstance = IsValid(World) ? World->GetGameInstance() : nullptr;
+    return IsValid(GameInstance) ? GameInstance->GetSubsystem<UPS_TimerSubsystem>() : nullptr;
+}
 
 void UPS_TimerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
     Super::Initialize(Collection);
     
-    if (bDebug)
-    {
-        UE_LOG(LogTemp, Error, TEXT("========== PS_TimerSubsystem INITIALIZED =========="));
-        UE_LOG(LogTemp, Error, TEXT("PS_TimerSubsystem: Using FTickableGameObject for RealTime ticking"));
-    }
-    
-    bIsTicking = true;
-    
-    FTimerDelegate TickDelegate;
-    TickDelegate.BindUObject(this, &UPS_TimerSubsystem::TickTimers);
+    if (bDebug) UE_LOG(LogTemp, Log, TEXT("%S :: using FTickableGameObject for RealTime ticking"), __FUNCTION__);
     
+    // Registered by the first timer
+    _bIsTickRegistered = true;
+    UpdateTickRegistration();
 }
 
 void UPS_TimerSubsystem::Deinitialize()
 {
-    bIsTicking = false;
-    
-    Timers.Empty();
-    HandleToGuidMap.Empty();
+    _Slots.Empty();
+    _FreeSlots.Empty();
+    _Heap.Empty();
+    _PendingTimers.Empty();
+    _DilatedTimerCount = 0;
+    UpdateTickRegistration();
     
-    if (bDebug) UE_LOG(LogTemp, Warning, TEXT("PS_TimerSubsystem: Deinitialized"));
+    if (bDebug) UE_LOG(LogTemp, Log, TEXT("%S"), __FUNCTION__);
     
     Super::Deinitialize();
 }
 
+bool UPS_TimerSubsystem::IsTickable() const
+{
+    // Nothing to do before the earliest deadline
+    const UWorld* World = GetWorld();
+    return !_Heap.IsEmpty() && IsValid(World) && World->GetRealTimeSeconds() >= _Heap[0].EndTime;
+}
 
 void UPS_TimerSubsystem::Tick(float DeltaTime)
 {
     TickTimers();
 }
 
-FTimerHandle UPS_TimerSubsystem::SetTimerWithHandle(const FTimerDelegate& InDelegate, float InRate, bool bInLoop, float InFirstDelay, float CustomDilation)
+FPSTimerHandle UPS_TimerSubsystem::SetTimer(const FTimerDelegate& InDelegate, float InRate, bool bInLoop, float InFirstDelay, EPSTimerClock Clock, float CustomDilation, const AActor* DilationSource)
 {
     UWorld* World = GetWorld();
     if (!IsValid(World)) 
     {
-        if (bDebug) UE_LOG(LogTemp, Error, TEXT("SetTimerWithHandle: World invalid"));
-        return FTimerHandle();
-    }
-    
-    if (!InDelegate.IsBound()) 
-    {
-        if (bDebug) UE_LOG(LogTemp, Error, TEXT("SetTimerWithHandle: Delegate not bound"));
-        return FTimerHandle();
+        if (bDebug) UE_LOG(LogTemp, Error, TEXT("%S :: World invalid"), __FUNCTION__);
+        return FPSTimerHandle();
     }
 
-    // Créer un handle valide
-    FTimerHandle NewHandle;
-    FTimerDelegate DummyDelegate;
-    DummyDelegate.BindLambda([]() {});
-    World->GetTimerManager().SetTimer(NewHandle, DummyDelegate, 999999.f, false);
-    
-    if (!NewHandle.IsValid())
-    {
-        if (bDebug) UE_LOG(LogTemp, Error, TEXT("SetTimerWithHandle: Failed to create valid handle"));
-        return FTimerHandle();
-    }
-    
-    // Créer le timer
-    FGuid NewGuid = FGuid::NewGuid();
-    FRealTimeTimer NewTimer;
-    NewTimer.Delegate = MakeShared<FTimerDelegate>(InDelegate);
-    NewTimer.StartTime = World->GetRealTimeSeconds();
-    NewTimer.EndTime = NewTimer.StartTime + ((InFirstDelay > 0.f ? InFirstDelay : InRate) / CustomDilation);
-    NewTimer.Dilation = CustomDilation;
+    // Reuse a free slot, its generation was bumped when freed
+    const int32 SlotIndex = _FreeSlots.IsEmpty() ? _Slots.AddDefaulted() : _FreeSlots.Pop(EAllowShrinking::No);
+    FRealTimeTimer& NewTimer = _Slots[SlotIndex];
+    NewTimer.Delegate.Reset();
+    if (InDelegate.IsBound()) NewTimer.Delegate = MakeShared<FTimerDelegate>(InDelegate);
+    NewTimer.Clock = Clock;
+    NewTimer.DilationSource = DilationSource;
+    NewTimer.CustomDilation = CustomDilation > 0.f ? CustomDilation : 1.f;
+    NewTimer.CurrentRate = ComputeTimerRate(NewTimer);
+    NewTimer.EndTime = World->GetRealTimeSeconds() + ((InFirstDelay > 0.f ? InFirstDelay : InRate) / NewTimer.CurrentRate);
     NewTimer.Rate = InRate;
     NewTimer.bLoop = bInLoop;
-    NewTimer.bActive = true;
+    if (Clock != EPSTimerClock::REAL_TIME) _DilatedTimerCount++;
+    ArmTimer(SlotIndex);
+
+    FPSTimerHandle NewHandle;
+    NewHandle.Index = SlotIndex;
+    NewHandle.Generation = NewTimer.Generation;
 
-    Timers.Add(NewGuid, NewTimer);
-    HandleToGuidMap.Add(NewHandle, NewGuid);
+    UpdateTickRegistration();
     
-    if (bDebug) UE_LOG(LogTemp, Error, TEXT("SetTimerWithHandle: Created timer GUID=%s, EndTime=%f, TimeRemaining=%.2f"), 
-        *NewGuid.ToString(), NewTimer.EndTime, NewTimer.EndTime - World->GetRealTimeSeconds());
+    if (bDebug) UE_LOG(LogTemp, Log, TEXT("%S :: slot %i gen %u, TimeRemaining=%.2f, active %i"), __FUNCTION__,
+        SlotIndex, NewHandle.Generation, NewTimer.EndTime - World->GetRealTimeSeconds(), GetActiveTimerCount());
     
     return NewHandle;
 }
 
-void UPS_TimerSubsystem::ClearTimer(FTimerHandle& InHandle)
+void UPS_TimerSubsystem::ClearTimer(FPSTimerHandle& InHandle)
 {
-    if (!InHandle.IsValid()) return;
-
-    UWorld* World = GetWorld();
-    
-    if (const FGuid* FoundGuid = HandleToGuidMap.Find(InHandle))
+    if (const FRealTimeTimer* FoundTimer = FindTimer(InHandle))
     {
-        if (FRealTimeTimer* FoundTimer = Timers.Find(*FoundGuid))
+        if (FoundTimer->State == ERealTimeTimerState::ACTIVE)
+        {
+            HeapRemoveAt(FoundTimer->HeapIndex);
+        }
+        else
         {
-            FoundTimer->bActive = false;
+            _PendingTimers.RemoveSingleSwap(InHandle.Index, EAllowShrinking::No);
         }
-        Timers.Remove(*FoundGuid);
-        HandleToGuidMap.Remove(InHandle);
+        FreeSlot(InHandle.Index);
+        UpdateTickRegistration();
         
-        if (bDebug) UE_LOG(LogTemp, Warning, TEXT("ClearTimer: Cleared timer"));
+        if (bDebug) UE_LOG(LogTemp, Log, TEXT("%S :: Cleared slot %i"), __FUNCTION__, InHandle.Index);
+    }
+
+    InHandle.Invalidate();
+}
+
+bool UPS_TimerSubsystem::IsTimerActive(const FPSTimerHandle& InHandle) const
+{
+    return FindTimer(InHandle) != nullptr;
+}
+
+float UPS_TimerSubsystem::GetTimerRemaining(const FPSTimerHandle& InHandle) const
+{
+    const FRealTimeTimer* FoundTimer = FindTimer(InHandle);
+    if (!FoundTimer || !IsValid(GetWorld())) return -1.f;
+
+    return FMath::Max(static_cast<float>(FoundTimer->EndTime - GetWorld()->GetRealTimeSeconds()), 0.f) * FoundTimer->CurrentRate;
+}
+
+void UPS_TimerSubsystem::NotifyTimeDilationChanged()
+{
+    if (_DilatedTimerCount == 0 || !IsValid(GetWorld())) return;
+
+    const double CurrentRealTime = GetWorld()->GetRealTimeSeconds();
+
+    // Keep remaining time in timer clock, spend it at the new rate
+    auto RescaleTimer = [this, CurrentRealTime](FRealTimeTimer& Timer)
+    {
+        if (Timer.Clock == EPSTimerClock::REAL_TIME) return false;
+
+        const float NewRate = ComputeTimerRate(Timer);
+        if (FMath::IsNearlyEqual(NewRate, Timer.CurrentRate)) return false;
+
+        const double Remaining = FMath::Max(Timer.EndTime - CurrentRealTime, 0.0) * Timer.CurrentRate;
+        Timer.EndTime = CurrentRealTime + Remaining / NewRate;
+        Timer.CurrentRate = NewRate;
+        return true;
+    };
+
+    bool bHasRescaled = false;
+    for (FRealTimeTimerHeapEntry& Entry : _Heap)
+    {
+        FRealTimeTimer& Timer = _Slots[Entry.SlotIndex];
+        if (!RescaleTimer(Timer)) continue;
+
+        Entry.EndTime = Timer.EndTime;
+        bHasRescaled = true;
     }
 
-    if (IsValid(World))
+    // Timers armed during firing join the heap after the loop, with their rescaled deadline
+    for (const int32 SlotIndex : _PendingTimers)
     {
-        World->GetTimerManager().ClearTimer(InHandle);
+        RescaleTimer(_Slots[SlotIndex]);
     }
 
-    InHandle.Invalidate();
+    if (bHasRescaled) Heapify();
 }
 
-bool UPS_TimerSubsystem::IsTimerActive(const FTimerHandle& InHandle) const
+float UPS_TimerSubsystem::ComputeTimerRate(const FRealTimeTimer& Timer) const
 {
-    if (!InHandle.IsValid()) return false;
-    
-    if (const FGuid* FoundGuid = HandleToGuidMap.Find(InHandle))
+    float ClockRate = 1.f;
+    switch (Timer.Clock)
     {
-        if (const FRealTimeTimer* FoundTimer = Timers.Find(*FoundGuid))
-            return FoundTimer->bActive;
+    case EPSTimerClock::GAME_TIME:
+        ClockRate = UGameplayStatics::GetGlobalTimeDilation(GetWorld());
+        break;
+    case EPSTimerClock::ACTOR_TIME:
+        ClockRate = Timer.DilationSource.IsValid() ? Timer.DilationSource->GetActorTimeDilation() : UGameplayStatics::GetGlobalTimeDilation(GetWorld());
+        break;
+    default:
+        break;
     }
-    return false;
+
+    return FMath::Max(ClockRate * Timer.CustomDilation, KINDA_SMALL_NUMBER);
+}
+
+FRealTimeTimer* UPS_TimerSubsystem::FindTimer(const FPSTimerHandle& InHandle)
+{
+    if (!InHandle.IsValid() || !_Slots.IsValidIndex(InHandle.Index)) return nullptr;
+
+    FRealTimeTimer& Timer = _Slots[InHandle.Index];
+    return Timer.Generation == InHandle.Generation && Timer.State != ERealTimeTimerState::FREE ? &Timer : nullptr;
+}
+
+const FRealTimeTimer* UPS_TimerSubsystem::FindTimer(const FPSTimerHandle& InHandle) const
+{
+    return const_cast<UPS_TimerSubsystem*>(this)->FindTimer(InHandle);
+}
+
+void UPS_TimerSubsystem::ArmTimer(const int32 SlotIndex)
+{
+    // Already due timer set by a delegate would fire again in the same loop
+    if (_bIsFiring && _Slots[SlotIndex].EndTime <= _FiringTime)
+    {
+        _Slots[SlotIndex].State = ERealTimeTimerState::PENDING;
+        _PendingTimers.Add(SlotIndex);
+        return;
+    }
+
+    _Slots[SlotIndex].State = ERealTimeTimerState::ACTIVE;
+    HeapPush(SlotIndex);
+}
+
+void UPS_TimerSubsystem::FreeSlot(const int32 SlotIndex)
+{
+    FRealTimeTimer& Timer = _Slots[SlotIndex];
+    if (Timer.Clock != EPSTimerClock::REAL_TIME) _DilatedTimerCount--;
+
+    Timer.Delegate.Reset();
+    Timer.DilationSource.Reset();
+    Timer.Clock = EPSTimerClock::REAL_TIME;
+    Timer.State = ERealTimeTimerState::FREE;
+    Timer.HeapIndex = INDEX_NONE;
+
+    // 0 is the invalid handle generation
+    Timer.Generation = Timer.Generation == MAX_uint32 ? 1 : Timer.Generation + 1;
+    _FreeSlots.Add(SlotIndex);
+}
+
+void UPS_TimerSubsystem::UpdateTickRegistration()
+{
+    const bool bShouldTick = !_Heap.IsEmpty() || !_PendingTimers.IsEmpty();
+    if (bShouldTick == _bIsTickRegistered) return;
+
+    _bIsTickRegistered = bShouldTick;
+    SetTickableTickType(bShouldTick ? ETickableTickType::Conditional : ETickableTickType::Never);
+
+    if (bDebug) UE_LOG(LogTemp, Log, TEXT("%S :: tick %s"), __FUNCTION__, bShouldTick ? TEXT("registered") : TEXT("unregistered"));
 }
 
 void UPS_TimerSubsystem::TickTimers()
@@ -127,63 +234,135 @@ void UPS_TimerSubsystem::TickTimers()
     if (!IsValid(World)) return;
 
     const double CurrentRealTime = World->GetRealTimeSeconds();
+    int32 FiredCount = 0;
 
-    // Log debug périodique
-    static double LastDebugLog = 0;
-    if (CurrentRealTime - LastDebugLog > 0.5)
+    _bIsFiring = true;
+    _FiringTime = CurrentRealTime;
+    while (!_Heap.IsEmpty() && _Heap[0].EndTime <= CurrentRealTime)
     {
-        if (bDebug) UE_LOG(LogTemp, Log, TEXT("TickTimers: %d active timers at time %.2f"), Timers.Num(), CurrentRealTime);
-        LastDebugLog = CurrentRealTime;
-    }
-
-    TArray<FGuid> ToRemove;
-    TMap<FGuid, FRealTimeTimer> ToParkour = Timers;
-    for (auto& Pair : ToParkour)
-    {
-        FRealTimeTimer& Timer = Pair.Value;
-        
-        if (!Timer.bActive) continue;
+        const int32 SlotIndex = _Heap[0].SlotIndex;
 
-        const float TimeRemaining = Timer.EndTime - CurrentRealTime;
-        
-        if (CurrentRealTime >= Timer.EndTime)
+        // Slots can be reallocated by the delegate, keep the delegate alive by reference count
+        FRealTimeTimer& Timer = _Slots[SlotIndex];
+        TSharedPtr<FTimerDelegate> Delegate;
+        if (Timer.bLoop && Timer.Rate > 0.f)
         {
-            if (bDebug) UE_LOG(LogTemp, Error, TEXT("========== TIMER FIRED! GUID=%s =========="), *Pair.Key.ToString());
-            
-            if (Timer.Delegate.IsValid() && Timer.Delegate->IsBound())
-            {
-                if (bDebug) UE_LOG(LogTemp, Error, TEXT("Executing delegate..."));
-                Timer.Delegate->ExecuteIfBound();
-                if (bDebug) UE_LOG(LogTemp, Error, TEXT("Delegate executed successfully!"));
-            }
-            else
-            {
-                if (bDebug) UE_LOG(LogTemp, Error, TEXT("ERROR: Delegate is invalid or not bound!"));
-            }
-
+            // High frequency loop fast path: re-armed in place, one sift and no allocation
+            Delegate = Timer.Delegate;
+            Timer.CurrentRate = ComputeTimerRate(Timer);
+            Timer.EndTime = CurrentRealTime + (Timer.Rate / Timer.CurrentRate);
+            _Heap[0].EndTime = Timer.EndTime;
+            HeapSiftDown(0);
+        }
+        else
+        {
+            HeapRemoveAt(0);
             if (Timer.bLoop)
             {
-                Timer.StartTime = CurrentRealTime;
-                Timer.EndTime = CurrentRealTime + (Timer.Rate / Timer.Dilation);
+                // Zero rate loop, once per tick
+                Delegate = Timer.Delegate;
+                Timer.EndTime = CurrentRealTime;
+                ArmTimer(SlotIndex);
             }
             else
             {
-                Timer.bActive = false;
-                ToRemove.Add(Pair.Key);
+                Delegate = MoveTemp(Timer.Delegate);
+                FreeSlot(SlotIndex);
             }
         }
+
+        if (Delegate.IsValid()) Delegate->ExecuteIfBound();
+        FiredCount++;
     }
+    _bIsFiring = false;
 
-    for (const FGuid& Guid : ToRemove)
+    // Already due timers set during the loop
+    for (const int32 SlotIndex : _PendingTimers)
     {
-        Timers.Remove(Guid);
-        for (auto It = HandleToGuidMap.CreateIterator(); It; ++It)
-        {
-            if (It.Value() == Guid)
-            {
-                It.RemoveCurrent();
-                break;
-            }
-        }
+        _Slots[SlotIndex].State = ERealTimeTimerState::ACTIVE;
+        HeapPush(SlotIndex);
+    }
+    _PendingTimers.Reset();
+
+    UpdateTickRegistration();
+
+    if (bDebug && FiredCount > 0) UE_LOG(LogTemp, Log, TEXT("%S :: fired %i, active %i, next in %.3fs"), __FUNCTION__, FiredCount, GetActiveTimerCount(), GetNextDeadline() - CurrentRealTime);
+}
+
+#pragma region Heap
+//------------------
+
+void UPS_TimerSubsystem::HeapSwap(const int32 A, const int32 B)
+{
+    Swap(_Heap[A], _Heap[B]);
+    _Slots[_Heap[A].SlotIndex].HeapIndex = A;
+    _Slots[_Heap[B].SlotIndex].HeapIndex = B;
+}
+
+void UPS_TimerSubsystem::HeapPush(const int32 SlotIndex)
+{
+    FRealTimeTimerHeapEntry Entry;
+    Entry.EndTime = _Slots[SlotIndex].EndTime;
+    Entry.SlotIndex = SlotIndex;
+
+    const int32 HeapIndex = _Heap.Add(Entry);
+    _Slots[SlotIndex].HeapIndex = HeapIndex;
+    HeapSiftUp(HeapIndex);
+}
+
+void UPS_TimerSubsystem::HeapRemoveAt(const int32 HeapIndex)
+{
+    const int32 LastIndex = _Heap.Num() - 1;
+    const int32 SlotIndex = _Heap[HeapIndex].SlotIndex;
+    if (HeapIndex != LastIndex) HeapSwap(HeapIndex, LastIndex);
+
+    _Heap.Pop(EAllowShrinking::No);
+    _Slots[SlotIndex].HeapIndex = INDEX_NONE;
+
+    // Moved last element can go either way
+    if (HeapIndex < _Heap.Num())
+    {
+        HeapSiftUp(HeapIndex);
+        HeapSiftDown(HeapIndex);
     }
 }
+
+void UPS_TimerSubsystem::HeapSiftUp(int32 HeapIndex)
+{
+    while (HeapIndex > 0)
+    {
+        const int32 ParentIndex = (HeapIndex - 1) / 2;
+        if (!HeapLess(HeapIndex, ParentIndex)) return;
+
+        HeapSwap(HeapIndex, ParentIndex);
+        HeapIndex = ParentIndex;
+    }
+}
+
+void UPS_TimerSubsystem::HeapSiftDown(int32 HeapIndex)
+{
+    const int32 Count = _Heap.Num();
+    while (true)
+    {
+        const int32 LeftIndex = HeapIndex * 2 + 1;
+        if (LeftIndex >= Count) return;
+
+        const int32 RightIndex = LeftIndex + 1;
+        const int32 MinChild = RightIndex < Count && HeapLess(RightIndex, LeftIndex) ? RightIndex : LeftIndex;
+        if (!HeapLess(MinChild, HeapIndex)) return;
+
+        HeapSwap(HeapIndex, MinChild);
+        HeapIndex = MinChild;
+    }
+}
+
+void UPS_TimerSubsystem::Heapify()
+{
+    for (int32 HeapIndex = _Heap.Num() / 2 - 1; HeapIndex >= 0; --HeapIndex)
+    {
+        HeapSiftDown(HeapIndex);
+    }
+}
+
+//------------------
+#pragma endregion Heap
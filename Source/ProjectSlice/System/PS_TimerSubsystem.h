@@ -1,23 +1,90 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Tickable.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "PS_TimerSubsystem.generated.h"
 
+// Slot index + generation, a handle to a cleared or fired timer never match the reused slot
+USTRUCT(BlueprintType)
+struct FPSTimerHandle
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	int32 Index = INDEX_NONE;
+
+	UPROPERTY(Transient)
+	uint32 Generation = 0;
+
+	FORCEINLINE bool IsValid() const { return Index != INDEX_NONE && Generation != 0; }
+
+	FORCEINLINE void Invalidate() { Index = INDEX_NONE; Generation = 0; }
+
+	FORCEINLINE bool operator==(const FPSTimerHandle& Other) const { return Index == Other.Index && Generation == Other.Generation; }
+};
+
+// Time a timer counts in, every clock is scheduled on real time by its current rate
+UENUM(BlueprintType)
+enum class EPSTimerClock : uint8
+{
+	REAL_TIME				UMETA(DisplayName = "Real time", ToolTip="Real time scaled by the fixed custom dilation"),
+	GAME_TIME				UMETA(DisplayName = "Game time", ToolTip="Follow global time dilation"),
+	ACTOR_TIME				UMETA(DisplayName = "Actor time", ToolTip="Follow dilation source actor time dilation (global * custom)")
+};
+
+UENUM()
+enum class ERealTimeTimerState : uint8
+{
+	FREE					UMETA(DisplayName = "Free"),
+	ACTIVE					UMETA(DisplayName = "Active"),
+	PENDING					UMETA(DisplayName = "Pending")
+};
+
 USTRUCT()
 struct FRealTimeTimer
 {
 	GENERATED_BODY()
 
+	// Shared so a firing delegate stays alive if its timer is cleared or its slot reused meanwhile
 	TSharedPtr<FTimerDelegate> Delegate;
 	double EndTime = 0.0;
-	double StartTime = 0.0;
-	float Dilation = 1.0f;
-	bool bLoop = false;
-	bool bActive = true;
+
+	// Timer seconds per real second, updated when dilation change
+	float CurrentRate = 1.0f;
+
+	float CustomDilation = 1.0f;
 	float Rate = 0.0f;
+	bool bLoop = false;
+
+	EPSTimerClock Clock = EPSTimerClock::REAL_TIME;
+
+	TWeakObjectPtr<const AActor> DilationSource;
+
+	// Bumped each time the slot is freed
+	uint32 Generation = 1;
+
+	// Position in the heap, INDEX_NONE when not active
+	int32 HeapIndex = INDEX_NONE;
+
+	ERealTimeTimerState State = ERealTimeTimerState::FREE;
 };
 
+// End time copied in the heap so ordering never touch the slots
+struct FRealTimeTimerHeapEntry
+{
+	double EndTime = 0.0;
+	int32 SlotIndex = INDEX_NONE;
+};
+
+/**
+ * Every PSFl timer (dilated timers, callbacks, cooldowns, real time delay) in one scheduler.
+ * Timers count in real, game or actor time (EPSTimerClock) and are scheduled on real time from their current rate,
+ * NotifyTimeDilationChanged re-scales the remaining time of running game and actor time timers.
+ * Timers live in reused slots addressed by generation counted handles, active timers are ordered in a binary min heap on their end time
+ * with back indices so set and clear are O(log n). Timers already due when set while firing wait in a pending list until the fire loop ends.
+ * The subsystem is only registered for tick while timers exist, and only ticks once the earliest deadline is reached.
+ */
 UCLASS()
 class PROJECTSLICE_API UPS_TimerSubsystem : public UGameInstanceSubsystem, public FTickableGameObject
 {
@@ -27,32 +94,98 @@ public:
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void Deinitialize() override;
 
-	FTimerHandle SetTimerWithHandle(const FTimerDelegate& InDelegate, float InRate, bool bInLoop, float InFirstDelay = -1.0f, float CustomDilation = 1.0f);
-	void ClearTimer(FTimerHandle& InHandle);
+	static UPS_TimerSubsystem* Get(const UObject* WorldContextObject);
+
+	/**
+	 * @brief Arm a timer, an unbound delegate make a cooldown timer only queried by IsTimerActive
+	 * @param InRate: period in Clock seconds
+	 * @param InFirstDelay: first period if > 0
+	 * @param CustomDilation: multiply the clock rate
+	 * @param DilationSource: actor followed by ACTOR_TIME clock
+	 */
+	FPSTimerHandle SetTimer(const FTimerDelegate& InDelegate, float InRate, bool bInLoop, float InFirstDelay = -1.0f, EPSTimerClock Clock = EPSTimerClock::REAL_TIME, float CustomDilation = 1.0f, const AActor* DilationSource = nullptr);
+
+	void ClearTimer(FPSTimerHandle& InHandle);
 
-	bool IsTimerActive(const FTimerHandle& InHandle) const;
+	// Remaining time in the timer clock, -1 if not active
+	float GetTimerRemaining(const FPSTimerHandle& InHandle) const;
 
-	UPROPERTY()
-	TMap<FGuid, FRealTimeTimer> Timers;
-    
-	TMap<FTimerHandle, FGuid> HandleToGuidMap;
+	// Re-scale running game and actor time timers to the current dilations, called by dilation owners (slowmo)
+	void NotifyTimeDilationChanged();
+
+	bool IsTimerActive(const FPSTimerHandle& InHandle) const;
+
+	FORCEINLINE int32 GetActiveTimerCount() const { return _Heap.Num() + _PendingTimers.Num(); }
+
+	// Earliest end time in real time seconds, MAX_dbl if no timer
+	FORCEINLINE double GetNextDeadline() const { return _Heap.IsEmpty() ? MAX_dbl : _Heap[0].EndTime; }
 
 protected:
 	bool bDebug = false;
 
 private:
 	void TickTimers();
-	
-	bool bIsTicking = false;
+
+	FRealTimeTimer* FindTimer(const FPSTimerHandle& InHandle);
+
+	const FRealTimeTimer* FindTimer(const FPSTimerHandle& InHandle) const;
+
+	// Heap directly, pending list if already due while firing
+	void ArmTimer(const int32 SlotIndex);
+
+	void FreeSlot(const int32 SlotIndex);
+
+	float ComputeTimerRate(const FRealTimeTimer& Timer) const;
+
+	// Register for tick only while timers exist
+	void UpdateTickRegistration();
+
+#pragma region Heap
+	//------------------
+
+	FORCEINLINE bool HeapLess(const int32 A, const int32 B) const { return _Heap[A].EndTime < _Heap[B].EndTime; }
+
+	void HeapSwap(const int32 A, const int32 B);
+
+	void HeapPush(const int32 SlotIndex);
+
+	void HeapRemoveAt(const int32 HeapIndex);
+
+	void HeapSiftUp(int32 HeapIndex);
+
+	void HeapSiftDown(int32 HeapIndex);
+
+	void Heapify();
+
+	//------------------
+#pragma endregion Heap
+
+	TArray<FRealTimeTimer> _Slots;
+
+	TArray<int32> _FreeSlots;
+
+	// Min heap on EndTime
+	TArray<FRealTimeTimerHeapEntry> _Heap;
+
+	TArray<int32> _PendingTimers;
+
+	// Game and actor time timers, re-scaled on dilation change
+	int32 _DilatedTimerCount = 0;
+
+	bool _bIsFiring = false;
+
+	bool _bIsTickRegistered = false;
+
+	double _FiringTime = 0.0;
 
 #pragma region IntrerfaceTickableGameObject
 	//------------------
 
 	virtual void Tick(float DeltaTime) override;
-	virtual bool IsTickable() const override { return bIsTicking; }
+	virtual bool IsTickable() const override;
 	virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UPS_TimerSubsystem, STATGROUP_Tickables); }
 	virtual UWorld* GetTickableGameObjectWorld() const override { return GetWorld(); }
 
 	//------------------
 #pragma endregion IntrerfaceTickableGameObject
-};
\ No newline at end of file
+};